@@ -0,0 +1,354 @@
+/**
+ * @file format_bench.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief nva_format 与 snprintf 的性能对比
+ *
+ * 每种格式说明符各有一组 nva 与 snprintf 的用例，输入完全相同。
+ * 参数压栈也计入 nva 的耗时，因为实际使用时每次调用都需要压栈。
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "nva/print.h"
+#include "nva/ext/json.h"
+#include "nva/ext/bytes.h"
+#include "nva/ext/csv.h"
+#include "nva/ext/timestamp.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+template<typename Func>
+static void BM_format(benchmark::State& state, Func func)
+{
+    char dst[256] = {0};
+
+    for (auto _ : state) {
+        func(dst);
+        benchmark::DoNotOptimize(dst);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::strlen(dst)));
+}
+
+// 计时之前先确认一次格式化成功，否则测到的只是出错返回的耗时
+template<typename Func>
+static void BM_nva_format(benchmark::State& state, Func func)
+{
+    char dst[256] = {0};
+
+    if (func(dst) != NVA_SUCCESS) {
+        state.SkipWithError("formatting did not return NVA_SUCCESS");
+        return;
+    }
+
+    BM_format(state, func);
+}
+
+template<typename Func>
+static void BM_snprintf(benchmark::State& state, Func func)
+{
+    BM_format(state, func);
+}
+
+// 让编译器无法把输入当作常量折叠
+template<typename T>
+static T opaque(T value)
+{
+    benchmark::DoNotOptimize(value);
+    return value;
+}
+
+// 用例不测量 nva_print，但链接 nva_print 需要输出端
+extern "C" int nva_putchar(const char c)
+{
+    benchmark::DoNotOptimize(c);
+
+    return 1;
+}
+
+/* 整数 */
+BENCHMARK_CAPTURE(BM_nva_format, int_plain, [](char* dst) {
+    return nva_format(dst, "{}", nva_int(opaque(-123456), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_nva_format, int_plain_cpp, [](char* dst) {
+    return nva::format(dst, "{}", nva::add(opaque(-123456), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_snprintf, int_plain, [](char* dst) {
+    std::snprintf(dst, 256, "%d", opaque(-123456));
+});
+
+BENCHMARK_CAPTURE(BM_nva_format, int_padded, [](char* dst) {
+    return nva_format(dst,
+                      "[{:>10}|{:<10}|{:08d}]",
+                      nva_int(opaque(42), nva_int(opaque(-42), nva_int(opaque(1456), NVA_START))));
+});
+BENCHMARK_CAPTURE(BM_snprintf, int_padded, [](char* dst) {
+    std::snprintf(dst, 256, "[%10d|%-10d|%08d]", opaque(42), opaque(-42), opaque(1456));
+});
+
+BENCHMARK_CAPTURE(BM_nva_format, int_hex_alt, [](char* dst) {
+    return nva_format(dst,
+                      "{:#x} {:#X} {:#010x}",
+                      nva_int(opaque(0xBEEF), nva_int(opaque(0xCAFE), nva_int(opaque(0x653), NVA_START))));
+});
+BENCHMARK_CAPTURE(BM_snprintf, int_hex_alt, [](char* dst) {
+    std::snprintf(dst, 256, "%#x %#X %#010x", opaque(0xBEEF), opaque(0xCAFE), opaque(0x653));
+});
+
+/* 浮点数 */
+BENCHMARK_CAPTURE(BM_nva_format, float_fixed, [](char* dst) {
+    return nva_format(dst, "{:.3f}", nva_double(opaque(123.456789), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_nva_format, float_fixed_cpp, [](char* dst) {
+    return nva::format(dst, "{:.3f}", nva::add(opaque(123.456789), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_snprintf, float_fixed, [](char* dst) {
+    std::snprintf(dst, 256, "%.3f", opaque(123.456789));
+});
+
+BENCHMARK_CAPTURE(BM_nva_format, float_general, [](char* dst) {
+    return nva_format(dst, "{:g}", nva_double(opaque(123.456789), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_snprintf, float_general, [](char* dst) {
+    std::snprintf(dst, 256, "%g", opaque(123.456789));
+});
+
+/* 字符串 */
+BENCHMARK_CAPTURE(BM_nva_format, string_plain, [](char* dst) {
+    return nva_format(dst, "Hello, {}!", nva_str(opaque("world, this is a longer string argument"), NVA_START));
+});
+BENCHMARK_CAPTURE(BM_snprintf, string_plain, [](char* dst) {
+    std::snprintf(dst, 256, "Hello, %s!", opaque("world, this is a longer string argument"));
+});
+
+BENCHMARK_CAPTURE(BM_nva_format, string_padded, [](char* dst) {
+    return nva_format(dst, "[{:>20}|{:<20}]", nva_str(opaque("right"), nva_str(opaque("left"), NVA_START)));
+});
+BENCHMARK_CAPTURE(BM_snprintf, string_padded, [](char* dst) {
+    std::snprintf(dst, 256, "[%20s|%-20s]", opaque("right"), opaque("left"));
+});
+
+/* 位置参数 */
+BENCHMARK_CAPTURE(BM_nva_format, positional, [](char* dst) {
+    return nva_format(dst,
+                      "array = [{2}, {0}, {1}].",
+                      nva_int(opaque(1), nva_int(opaque(2), nva_int(opaque(3), NVA_START))));
+});
+BENCHMARK_CAPTURE(BM_snprintf, positional, [](char* dst) {
+    std::snprintf(dst, 256, "array = [%3$d, %1$d, %2$d].", opaque(1), opaque(2), opaque(3));
+});
+
+/* 没有参数 */
+BENCHMARK_CAPTURE(BM_nva_format, literal_only, [](char* dst) {
+    return nva_format(dst, opaque("std::vector vec{{1, 2, 3, 4}};"), NVA_START);
+});
+BENCHMARK_CAPTURE(BM_snprintf, literal_only, [](char* dst) {
+    std::snprintf(dst, 256, "%s", opaque("std::vector vec{1, 2, 3, 4};"));
+});
+
+/* 典型的日志行 */
+BENCHMARK_CAPTURE(BM_nva_format, mixed_line, [](char* dst) {
+    return nva_format(dst,
+                      "Number: {1}, Hex: {0:x}, FloatPoint: {2:.2f}",
+                      nva_int(opaque(0xFF), nva_int(opaque(42), nva_float(opaque(3.14159f), NVA_START))));
+});
+BENCHMARK_CAPTURE(BM_snprintf, mixed_line, [](char* dst) {
+    std::snprintf(dst, 256, "Number: %d, Hex: %x, FloatPoint: %.2f", opaque(42), opaque(0xFF), opaque(3.14159f));
+});
+
+/* JSON 行：nva_formatJsonArgs 一次完成转义与格式化，对比先转义再 nva_format 的两遍做法 */
+static const char* const json_keys[] = {"level", "code", "msg"};
+static const nva_TypeId json_types[] = {NVA_TYPEID_STR, NVA_TYPEID_SINT, NVA_TYPEID_STR};
+
+static void escape_json(char* dst, const char* src)
+{
+    for (; *src != '\0'; ++src) {
+        if (*src == '"' || *src == '\\') {
+            *dst++ = '\\';
+            *dst++ = *src;
+        }
+        else if (static_cast<unsigned char>(*src) < 0x20U) {
+            dst += std::snprintf(dst, 7, "\\u%04x", static_cast<unsigned char>(*src));
+        }
+        else {
+            *dst++ = *src;
+        }
+    }
+    *dst = '\0';
+}
+
+BENCHMARK_CAPTURE(BM_nva_format, json_line, [](char* dst) {
+    const char* const level = opaque("info");
+    const int code = opaque(200);
+    const char* const msg = opaque("GET /api/v1/items?q=\"a\" took 12ms");
+    const void* const values[] = {&level, &code, &msg};
+    return nva_formatJsonArgs(dst, 256U, json_keys, json_types, values, 3U);
+});
+BENCHMARK_CAPTURE(BM_nva_format, json_ext_escape, [](char* dst) {
+    char level[32];
+    char msg[256];
+    const char* const src = opaque("GET /api/v1/items?q=\"a\" took 12ms");
+    nva_jsonEscape(level, opaque("info"), 4U);
+    nva_jsonEscape(msg, src, std::strlen(src));
+    return nva_format(dst,
+                      "{{\"level\":\"{}\",\"code\":{},\"msg\":\"{}\"}}",
+                      nva_str(level, nva_int(opaque(200), nva_str(msg, NVA_START))));
+});
+BENCHMARK_CAPTURE(BM_nva_format, json_two_pass, [](char* dst) {
+    char escaped[128];
+    escape_json(escaped, opaque("GET /api/v1/items?q=\"a\" took 12ms"));
+    return nva_format(dst, "{{\"level\":\"{}\",\"code\":{},\"msg\":\"{}\"}}",
+                      nva_str(opaque("info"), nva_int(opaque(200), nva_str(escaped, NVA_START))));
+});
+
+/* CSV 行：列格式只在初始化时解析一次，对比每行调用一次 nva_format */
+static const nva_CsvColumn csv_columns[] = {
+    {"name", NVA_TYPEID_STR, ""},
+    {"id", NVA_TYPEID_UINT, "x"},
+    {"delta", NVA_TYPEID_SINT, ""},
+    {"value", NVA_TYPEID_DOUBLE, ".3f"},
+};
+
+static nva_ErrorCode discard_flush(void* const ctx, const char* const buf, const nva_Size len)
+{
+    (void)ctx;
+    benchmark::DoNotOptimize(buf);
+    benchmark::DoNotOptimize(len);
+    return NVA_SUCCESS;
+}
+
+static void BM_nva_csv_row(benchmark::State& state)
+{
+    static char buffer[64 << 10];
+    nva_CsvWriter writer;
+
+    if (nva_csvWriterInit(&writer, csv_columns, NVA_COUNTOF(csv_columns), ',', buffer, sizeof(buffer), discard_flush,
+                          nullptr) != NVA_SUCCESS) {
+        state.SkipWithError("nva_csvWriterInit did not return NVA_SUCCESS");
+        return;
+    }
+
+    const char* const name = "cpu,total";
+    const unsigned int id = 0xBEEFU;
+    const int delta = -42;
+    const double value = 1234.56789;
+    const void* const values[] = {&name, &id, &delta, &value};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nva_csvWriteRow(&writer, values));
+    }
+    nva_csvFlush(&writer);
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_nva_csv_row);
+
+static void BM_nva_format_csv_row(benchmark::State& state)
+{
+    static char buffer[64 << 10];
+    std::size_t len = 0U;
+
+    for (auto _ : state) {
+        if (len + 128U > sizeof(buffer)) len = 0U;
+        nva_format(buffer + len, "\"{}\",{:x},{},{:.3f}\r\n",
+                   nva_str(opaque("cpu,total"),
+                           nva_uint(opaque(0xBEEFU), nva_int(opaque(-42), nva_double(opaque(1234.56789), NVA_START)))));
+        len += std::strlen(buffer + len);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_nva_format_csv_row);
+
+/* 字节块：1500 字节的以太网帧，逐字节调用 nva_format 对比一次 nva_ext 编码调用 */
+static const std::vector<unsigned char> bytes_frame = [] {
+    std::vector<unsigned char> frame(1500U);
+    for (std::size_t i = 0U; i < frame.size(); ++i) {
+        frame[i] = static_cast<unsigned char>(i * 131U + 7U);
+    }
+    return frame;
+}();
+
+template<typename Func>
+static void BM_bytes(benchmark::State& state, Func func)
+{
+    static char dst[8192];
+
+    for (auto _ : state) {
+        func(dst, opaque(bytes_frame.data()), bytes_frame.size());
+        benchmark::DoNotOptimize(dst);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes_frame.size()));
+}
+
+BENCHMARK_CAPTURE(BM_bytes, hex_per_byte_loop, [](char* dst, const unsigned char* data, const std::size_t len) {
+    for (std::size_t i = 0U; i < len; ++i) {
+        nva_format(dst + 2U * i, "{:02x}", nva_uchar(data[i], NVA_START));
+    }
+});
+BENCHMARK_CAPTURE(BM_bytes, hex, [](char* dst, const unsigned char* data, const std::size_t len) {
+    nva_hexEncode(dst, data, len, 0);
+});
+BENCHMARK_CAPTURE(BM_bytes, hexdump, [](char* dst, const unsigned char* data, const std::size_t len) {
+    nva_hexdump(dst, data, len);
+});
+BENCHMARK_CAPTURE(BM_bytes, b64, [](char* dst, const unsigned char* data, const std::size_t len) {
+    nva_base64Encode(dst, data, len);
+});
+
+/* 日志行时间戳：七个整数参数的 nva_format，对比秒级缓存只改写微秒部分 */
+BENCHMARK_CAPTURE(BM_nva_format, timestamp_seven_args, [](char* dst) {
+    return nva_format(dst, "{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:06d}",
+                      nva_int(opaque(2025), nva_int(opaque(10), nva_int(opaque(19), nva_int(opaque(11),
+                              nva_int(opaque(59), nva_int(opaque(59), nva_ulong(opaque(42UL), NVA_START))))))));
+});
+BENCHMARK_CAPTURE(BM_snprintf, timestamp_strftime, [](char* dst) {
+    const std::time_t sec = opaque(1760875199L);
+    std::tm tm{};
+    gmtime_r(&sec, &tm);
+    const std::size_t len = std::strftime(dst, 256, "%Y-%m-%d %H:%M:%S", &tm);
+    std::snprintf(dst + len, 256 - len, ".%06lu", opaque(42UL));
+});
+
+/* 同一秒内的多行日志：命中缓存 */
+static void BM_nva_timestamp_same_second(benchmark::State& state)
+{
+    nva_TimestampCache cache = NVA_TIMESTAMP_CACHE_INIT_VALUE;
+    char dst[NVA_TIMESTAMP_LEN + 1] = {0};
+    unsigned long usec = 0U;
+
+    for (auto _ : state) {
+        nva_timestampRender(&cache, opaque(1760875199ULL), usec, dst);
+        usec = (usec + 7U) % 1000000U;
+        benchmark::DoNotOptimize(dst);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_nva_timestamp_same_second);
+
+/* 每行都跨过一秒：每次都重新生成日期与时分秒 */
+static void BM_nva_timestamp_new_second(benchmark::State& state)
+{
+    nva_TimestampCache cache = NVA_TIMESTAMP_CACHE_INIT_VALUE;
+    char dst[NVA_TIMESTAMP_LEN + 1] = {0};
+    unsigned long long sec = 1760875199ULL;
+
+    for (auto _ : state) {
+        nva_timestampRender(&cache, sec++, opaque(42UL), dst);
+        benchmark::DoNotOptimize(dst);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_nva_timestamp_new_second);
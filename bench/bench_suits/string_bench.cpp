@@ -0,0 +1,463 @@
+/**
+ * @file string_bench.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief nva/string.h 与 libc 的吞吐对比
+ *
+ * 覆盖 nva_memcpy_test.cpp、nva_memmove_test.cpp 与 nva_memcmp_test.cpp 中的尺寸与对齐组合
+ * （1 字节 ~ 32 MiB，源/目的地址错位，前向/后向重叠），用于判断在生产环境中开启 NVA_NO_STRING_H 是否安全。
+ */
+
+#include "benchmark/benchmark.h"
+
+#include "nva/string.h"
+#include "nva/ext/string.h"
+#include "nva/ext/strbuf.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+static constexpr std::size_t kAlign = 64U;
+
+/* 按 64 字节对齐的缓冲区，offset 在对齐地址的基础上再偏移 */
+class AlignedBuffer
+{
+public:
+    explicit AlignedBuffer(const std::size_t size) : storage(size + 2U * kAlign, 0x5A)
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(storage.data());
+        base = storage.data() + ((kAlign - addr % kAlign) % kAlign);
+    }
+
+    uint8_t* at(const std::size_t offset)
+    {
+        return base + offset;
+    }
+
+private:
+    std::vector<uint8_t> storage;
+    uint8_t* base;
+};
+
+static void size_and_align_args(benchmark::internal::Benchmark* bench)
+{
+    const int64_t sizes[] = {1, 7, 8, 16, 64, 127, 512, 4096, 64 << 10, 1 << 20, 32 << 20};
+    const int64_t offsets[][2] = {{0, 0}, {1, 0}, {0, 1}, {1, 1}, {3, 7}};
+
+    bench->ArgNames({"size", "src_off", "dst_off"});
+    for (const auto size : sizes) {
+        for (const auto& off : offsets) {
+            bench->Args({size, off[0], off[1]});
+        }
+    }
+}
+
+static void overlap_args(benchmark::internal::Benchmark* bench)
+{
+    const int64_t sizes[] = {8, 64, 512, 4096, 64 << 10, 1 << 20, 32 << 20};
+    const int64_t shifts[] = {1, 8, 63};
+
+    bench->ArgNames({"size", "backward", "shift"});
+    for (const auto size : sizes) {
+        for (const auto shift : shifts) {
+            bench->Args({size, 0, shift});
+            bench->Args({size, 1, shift});
+        }
+    }
+}
+
+static void strlen_args(benchmark::internal::Benchmark* bench)
+{
+    const int64_t sizes[] = {0, 1, 7, 15, 16, 31, 64, 255, 4096, 64 << 10, 1 << 20};
+    const int64_t offsets[] = {0, 1, 7};
+
+    bench->ArgNames({"len", "off"});
+    for (const auto size : sizes) {
+        for (const auto off : offsets) {
+            bench->Args({size, off});
+        }
+    }
+}
+
+/* 互不重叠的拷贝 */
+template<typename Func>
+static void copy_bench(benchmark::State& state, Func func)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer src(size);
+    AlignedBuffer dst(size);
+    uint8_t* const s = src.at(static_cast<std::size_t>(state.range(1)));
+    uint8_t* const d = dst.at(static_cast<std::size_t>(state.range(2)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(func(d, s, size));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+/* 同一缓冲区内的重叠移动，backward 为 1 时目的地址在源地址之前 */
+template<typename Func>
+static void overlap_bench(benchmark::State& state, Func func)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto shift = static_cast<std::size_t>(state.range(2));
+    AlignedBuffer buffer(size + shift);
+    uint8_t* const low = buffer.at(0U);
+    uint8_t* const high = buffer.at(shift);
+
+    for (auto _ : state) {
+        if (state.range(1) == 0) {
+            benchmark::DoNotOptimize(func(high, low, size));
+        }
+        else {
+            benchmark::DoNotOptimize(func(low, high, size));
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename Func>
+static void strlen_bench(benchmark::State& state, Func func)
+{
+    const auto len = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer buffer(len + 1U);
+    char* const str = reinterpret_cast<char*>(buffer.at(static_cast<std::size_t>(state.range(1))));
+    std::memset(str, 'a', len);
+    str[len] = '\0';
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(str);
+        benchmark::DoNotOptimize(func(str));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(len + 1U));
+}
+
+/* 两侧内容相同，比较必须走完全部 size 字节 */
+template<typename Func>
+static void compare_bench(benchmark::State& state, Func func)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer lhs(size);
+    AlignedBuffer rhs(size);
+    uint8_t* const l = lhs.at(static_cast<std::size_t>(state.range(1)));
+    uint8_t* const r = rhs.at(static_cast<std::size_t>(state.range(2)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l);
+        benchmark::DoNotOptimize(func(l, r, size));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+template<typename Func>
+static void strcmp_bench(benchmark::State& state, Func func)
+{
+    const auto len = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer lhs(len + 1U);
+    AlignedBuffer rhs(len + 1U);
+    char* const l = reinterpret_cast<char*>(lhs.at(static_cast<std::size_t>(state.range(1))));
+    char* const r = reinterpret_cast<char*>(rhs.at(0U));
+    std::memset(l, 'a', len);
+    std::memset(r, 'a', len);
+    l[len] = '\0';
+    r[len] = '\0';
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(l);
+        benchmark::DoNotOptimize(func(l, r));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(len + 1U));
+}
+
+static void BM_nva_memcpy(benchmark::State& state)
+{
+    copy_bench(state, [](void* d, const void* s, const std::size_t n) { return nva_memcpy(d, s, n); });
+}
+
+static void BM_libc_memcpy(benchmark::State& state)
+{
+    copy_bench(state, [](void* d, const void* s, const std::size_t n) { return std::memcpy(d, s, n); });
+}
+
+static void BM_nva_memmove(benchmark::State& state)
+{
+    copy_bench(state, [](void* d, const void* s, const std::size_t n) { return nva_memmove(d, s, n); });
+}
+
+static void BM_libc_memmove(benchmark::State& state)
+{
+    copy_bench(state, [](void* d, const void* s, const std::size_t n) { return std::memmove(d, s, n); });
+}
+
+static void BM_nva_memmove_overlap(benchmark::State& state)
+{
+    overlap_bench(state, [](void* d, const void* s, const std::size_t n) { return nva_memmove(d, s, n); });
+}
+
+static void BM_libc_memmove_overlap(benchmark::State& state)
+{
+    overlap_bench(state, [](void* d, const void* s, const std::size_t n) { return std::memmove(d, s, n); });
+}
+
+static void BM_nva_strlen(benchmark::State& state)
+{
+    strlen_bench(state, [](const char* s) { return nva_strlen(s); });
+}
+
+static void BM_libc_strlen(benchmark::State& state)
+{
+    strlen_bench(state, [](const char* s) { return std::strlen(s); });
+}
+
+static void BM_nva_memcmp(benchmark::State& state)
+{
+    compare_bench(state, [](const void* l, const void* r, const std::size_t n) { return nva_memcmp(l, r, n); });
+}
+
+static void BM_libc_memcmp(benchmark::State& state)
+{
+    compare_bench(state, [](const void* l, const void* r, const std::size_t n) { return std::memcmp(l, r, n); });
+}
+
+static void BM_nva_strcmp(benchmark::State& state)
+{
+    strcmp_bench(state, [](const char* l, const char* r) { return nva_strcmp(l, r); });
+}
+
+static void BM_libc_strcmp(benchmark::State& state)
+{
+    strcmp_bench(state, [](const char* l, const char* r) { return std::strcmp(l, r); });
+}
+
+/* 查找位于末尾的字节，必须扫描全部 size 字节 */
+template<typename Func>
+static void search_bench(benchmark::State& state, Func func)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer buffer(size);
+    uint8_t* const buf = buffer.at(static_cast<std::size_t>(state.range(1)));
+    std::memset(buf, 'a', size);
+    buf[size - 1U] = '}';
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buf);
+        benchmark::DoNotOptimize(func(buf, size));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+static void fill_args(benchmark::internal::Benchmark* bench)
+{
+    const int64_t sizes[] = {1, 7, 16, 30, 64, 200, 4096, 64 << 10, 1 << 20};
+    const int64_t offsets[] = {0, 1, 7};
+
+    bench->ArgNames({"size", "off"});
+    for (const auto size : sizes) {
+        for (const auto off : offsets) {
+            bench->Args({size, off});
+        }
+    }
+}
+
+static void BM_nva_memset(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer buffer(size);
+    uint8_t* const buf = buffer.at(static_cast<std::size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nva_memset(buf, '*', size));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+static void BM_libc_memset(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    AlignedBuffer buffer(size);
+    uint8_t* const buf = buffer.at(static_cast<std::size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::memset(buf, '*', size));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+static void BM_nva_memchr(benchmark::State& state)
+{
+    search_bench(state, [](const void* s, const std::size_t n) { return nva_memchr(s, '}', n); });
+}
+
+static void BM_libc_memchr(benchmark::State& state)
+{
+    search_bench(state, [](const void* s, const std::size_t n) { return std::memchr(s, '}', n); });
+}
+
+static void BM_nva_memchr2(benchmark::State& state)
+{
+    search_bench(state, [](const void* s, const std::size_t n) { return nva_memchr2(s, '{', '}', n); });
+}
+
+/* 常量尺寸的小拷贝，对应 nva_Stack 压入/取出单个参数 */
+template<std::size_t N>
+static void BM_nva_memcpy_small(benchmark::State& state)
+{
+    AlignedBuffer src(N);
+    AlignedBuffer dst(N);
+    uint8_t* const s = src.at(1U);
+    uint8_t* const d = dst.at(3U);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nva_memcpy(d, s, N));
+        benchmark::ClobberMemory();
+    }
+}
+
+template<std::size_t N>
+static void BM_NVA_MEMCPY_CONST(benchmark::State& state)
+{
+    AlignedBuffer src(N);
+    AlignedBuffer dst(N);
+    uint8_t* const s = src.at(1U);
+    uint8_t* const d = dst.at(3U);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(s);
+        NVA_MEMCPY_CONST(d, s, N);
+        benchmark::ClobberMemory();
+    }
+}
+
+/* 由 N 个 8 字节片段拼出一行：nva_strcat 每次都要重新扫描目的串 */
+static void BM_nva_strcat_pieces(benchmark::State& state)
+{
+    const auto pieces = static_cast<std::size_t>(state.range(0));
+    std::vector<char> line(pieces * 8U + 1U);
+
+    for (auto _ : state) {
+        line[0] = '\0';
+        for (std::size_t i = 0U; i < pieces; ++i) {
+            nva_strcat(line.data(), "piece-7,");
+        }
+        benchmark::DoNotOptimize(line.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pieces));
+}
+
+static void BM_nva_strbuf_pieces(benchmark::State& state)
+{
+    const auto pieces = static_cast<std::size_t>(state.range(0));
+    std::vector<char> line(pieces * 8U + 1U);
+    nva_StrBuf sb;
+    nva_strBufInit(&sb, line.data(), line.size());
+
+    for (auto _ : state) {
+        nva_strBufClear(&sb);
+        for (std::size_t i = 0U; i < pieces; ++i) {
+            nva_strBufAppendStr(&sb, "piece-7,");
+        }
+        benchmark::DoNotOptimize(sb.buf);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(pieces));
+}
+
+/* 只关心阈值以上的大尺寸；线程数为 0 时由库决定 */
+static void parallel_args(benchmark::internal::Benchmark* bench)
+{
+    const int64_t sizes[] = {1 << 20, 16 << 20, 128 << 20};
+    const int64_t threads[] = {0, 1, 2, 4, 8};
+
+    bench->ArgNames({"size", "threads"});
+    for (const auto size : sizes) {
+        for (const auto thread : threads) {
+            bench->Args({size, thread});
+        }
+    }
+    bench->UseRealTime();
+}
+
+static void BM_nva_memcpyParallel(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto threads = static_cast<unsigned int>(state.range(1));
+    AlignedBuffer src(size);
+    AlignedBuffer dst(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nva_memcpyParallel(dst.at(0U), src.at(0U), size, threads));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+static void BM_nva_memmoveParallel_overlap(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto threads = static_cast<unsigned int>(state.range(1));
+    AlignedBuffer buffer(size + 4096U);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nva_memmoveParallel(buffer.at(4096U), buffer.at(0U), size, threads));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK(BM_nva_memcpy)->Apply(size_and_align_args);
+BENCHMARK(BM_libc_memcpy)->Apply(size_and_align_args);
+
+BENCHMARK(BM_nva_memmove)->Apply(size_and_align_args);
+BENCHMARK(BM_libc_memmove)->Apply(size_and_align_args);
+
+BENCHMARK(BM_nva_memmove_overlap)->Apply(overlap_args);
+BENCHMARK(BM_libc_memmove_overlap)->Apply(overlap_args);
+
+BENCHMARK(BM_nva_strlen)->Apply(strlen_args);
+BENCHMARK(BM_libc_strlen)->Apply(strlen_args);
+
+BENCHMARK(BM_nva_memcmp)->Apply(size_and_align_args);
+BENCHMARK(BM_libc_memcmp)->Apply(size_and_align_args);
+
+BENCHMARK(BM_nva_strcmp)->Apply(strlen_args);
+BENCHMARK(BM_libc_strcmp)->Apply(strlen_args);
+
+BENCHMARK(BM_nva_memset)->Apply(fill_args);
+BENCHMARK(BM_libc_memset)->Apply(fill_args);
+
+BENCHMARK(BM_nva_memchr)->Apply(fill_args);
+BENCHMARK(BM_libc_memchr)->Apply(fill_args);
+BENCHMARK(BM_nva_memchr2)->Apply(fill_args);
+
+BENCHMARK_TEMPLATE(BM_nva_memcpy_small, 1);
+BENCHMARK_TEMPLATE(BM_nva_memcpy_small, 2);
+BENCHMARK_TEMPLATE(BM_nva_memcpy_small, 4);
+BENCHMARK_TEMPLATE(BM_nva_memcpy_small, 8);
+BENCHMARK_TEMPLATE(BM_nva_memcpy_small, 16);
+BENCHMARK_TEMPLATE(BM_NVA_MEMCPY_CONST, 1);
+BENCHMARK_TEMPLATE(BM_NVA_MEMCPY_CONST, 2);
+BENCHMARK_TEMPLATE(BM_NVA_MEMCPY_CONST, 4);
+BENCHMARK_TEMPLATE(BM_NVA_MEMCPY_CONST, 8);
+BENCHMARK_TEMPLATE(BM_NVA_MEMCPY_CONST, 16);
+
+BENCHMARK(BM_nva_memcpyParallel)->Apply(parallel_args);
+BENCHMARK(BM_nva_memmoveParallel_overlap)->Apply(parallel_args);
+
+BENCHMARK(BM_nva_strcat_pieces)->ArgName("pieces")->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(BM_nva_strbuf_pieces)->ArgName("pieces")->RangeMultiplier(4)->Range(4, 4096);
@@ -0,0 +1,19 @@
+/**
+ * @file nva_user_options.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 基准测试的配置
+ */
+
+#pragma once
+#ifndef NVA_NVA_USER_OPTIONS_H
+#define NVA_NVA_USER_OPTIONS_H
+
+#define NVA_NO_STDDEF_H
+#define NVA_NO_STDBOOL_H
+
+#define NVA_SIZE_T             unsigned long long
+
+#define NVA_STACK_DEFAULT_SIZE 64
+
+#endif  // !NVA_NVA_USER_OPTIONS_H
@@ -0,0 +1,70 @@
+# 汇总每个配置的 nm 输出，生成 Markdown 格式的占用报告
+#
+# 用法：cmake -DFOOTPRINT_RESULTS="name=symbols.txt|..." -DFOOTPRINT_REPORT=report.md -P footprint_report.cmake
+
+string(REPLACE "|" ";" results "${FOOTPRINT_RESULTS}")
+
+set(summary "| configuration | .text | .rodata | .data | .bss | flash | ram |\n")
+string(APPEND summary "|---|--:|--:|--:|--:|--:|--:|\n")
+set(details "")
+
+foreach (result IN LISTS results)
+    string(FIND "${result}" "=" eq_pos)
+    string(SUBSTRING "${result}" 0 ${eq_pos} name)
+    math(EXPR path_pos "${eq_pos} + 1")
+    string(SUBSTRING "${result}" ${path_pos} -1 path)
+
+    if (NOT EXISTS "${path}")
+        message(WARNING "${name}: ${path} not found")
+        continue()
+    endif ()
+
+    file(STRINGS "${path}" lines)
+
+    set(text 0)
+    set(rodata 0)
+    set(data 0)
+    set(bss 0)
+    set(rows "")
+
+    foreach (line IN LISTS lines)
+        # <地址> <大小> <类型> <符号名>
+        if (NOT line MATCHES "^[0-9]+ ([0-9]+) ([A-Za-z]) (.+)$")
+            continue()
+        endif ()
+
+        math(EXPR size "${CMAKE_MATCH_1}")
+        string(TOLOWER "${CMAKE_MATCH_2}" type)
+        set(symbol "${CMAKE_MATCH_3}")
+
+        if (type STREQUAL "t")
+            set(section ".text")
+            math(EXPR text "${text} + ${size}")
+        elseif (type STREQUAL "r")
+            set(section ".rodata")
+            math(EXPR rodata "${rodata} + ${size}")
+        elseif (type STREQUAL "d")
+            set(section ".data")
+            math(EXPR data "${data} + ${size}")
+        elseif (type STREQUAL "b" OR type STREQUAL "c")
+            set(section ".bss")
+            math(EXPR bss "${bss} + ${size}")
+        else ()
+            continue()
+        endif ()
+
+        string(APPEND rows "| ${symbol} | ${section} | ${size} |\n")
+    endforeach ()
+
+    math(EXPR flash "${text} + ${rodata} + ${data}")
+    math(EXPR ram "${data} + ${bss}")
+
+    string(APPEND summary "| ${name} | ${text} | ${rodata} | ${data} | ${bss} | ${flash} | ${ram} |\n")
+    string(APPEND details "\n### ${name}\n\n| symbol | section | size |\n|---|---|--:|\n${rows}")
+endforeach ()
+
+set(report "# nva_print footprint\n\n${summary}\n## Symbols\n${details}")
+
+file(WRITE "${FOOTPRINT_REPORT}" "${report}")
+message("${summary}")
+message("Full report: ${FOOTPRINT_REPORT}")
@@ -0,0 +1,10 @@
+/**
+ * @file footprint.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 占用统计的占位源文件，nva_print 的源文件通过链接关系加入同一个静态库
+ *
+ * 这里不定义任何符号，以免计入统计结果；nva_putchar 由最终的应用程序提供。
+ */
+
+typedef int nva_FootprintPlaceholder;
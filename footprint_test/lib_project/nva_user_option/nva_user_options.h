@@ -0,0 +1,21 @@
+/**
+ * @file nva_user_options.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 占用统计的配置，其余选项由 FOOTPRINT_CONFIGS 通过宏定义传入
+ */
+
+#pragma once
+#ifndef NVA_NVA_USER_OPTIONS_H
+#define NVA_NVA_USER_OPTIONS_H
+
+#define NVA_NO_STDDEF_H
+#define NVA_NO_STDBOOL_H
+
+#define NVA_SIZE_T unsigned int
+
+#ifndef NVA_STACK_DEFAULT_SIZE
+#define NVA_STACK_DEFAULT_SIZE 64
+#endif
+
+#endif /* !NVA_NVA_USER_OPTIONS_H */
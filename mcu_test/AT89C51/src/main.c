@@ -9,25 +9,57 @@
 
 #include "nva/print.h"
 #include "mcu_test_suits.h"
+#include "nva_tx_sink.h"
 
 void serialInit(void);
 
+static const char* tx_ptr;
+static unsigned char tx_left;
+
 int nva_putchar(char c)
 {
-    SBUF = c;
+    return nva_txSinkPutchar(c);
+}
+
+void nva_txPortStart(const char* buf, unsigned int len)
+{
+    tx_ptr = buf + 1;
+    tx_left = (unsigned char)(len - 1U);
+
+    SBUF = *buf;
+}
+
+void nva_txPortWait(void)
+{
+}
 
-	while (TI == 0) {
+void serialIsr(void) interrupt 4
+{
+    /* 不使用接收，但 RI 同样会触发串口中断，不清除会反复进入 */
+    if (RI) {
+        RI = 0;
+    }
+    if (TI == 0) {
+        return;
     }
-	TI = 0;
+    TI = 0;
 
-    return 1;
+    if (tx_left > 0U) {
+        SBUF = *tx_ptr++;
+        --tx_left;
+    }
+    else {
+        nva_txSinkOnComplete();
+    }
 }
 
 void main(void)
 {
     serialInit();
+    nva_txSinkInit();
 
     nva_mcu_test_run();
+    nva_txSinkDrain();
 
     while (1) {
     }
@@ -43,4 +75,7 @@ void serialInit(void)
 	TH1 = 0xFD;
 	ET1 = 0;
 	TR1 = 1;
+
+    ES = 1;
+    EA = 1;
 }
@@ -0,0 +1,256 @@
+/**
+ * @file main.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 在 QEMU 模拟的 Cortex-M 上运行 mcu_test，并统计每次 nva_print 的周期数与栈使用量
+ *
+ * 输出通过 semihosting 写到主机终端。QEMU 没有实现 DWT 的 CYCCNT，因此默认使用 SysTick 计数
+ * （配合 -icount shift=0，结果与执行的指令数成正比）；在真实硬件上运行时可以定义 NVA_QEMU_USE_DWT。
+ */
+
+#include <stdint.h>
+
+#include "nva/print.h"
+#include "mcu_test_suits.h"
+#include "nva_mcu_measure.h"
+
+#define SEMIHOST_SYS_WRITE0          0x04
+#define SEMIHOST_SYS_EXIT            0x18
+
+#define ADP_STOPPED_APPLICATION_EXIT 0x20026
+#define ADP_STOPPED_RUNTIME_ERROR    0x20023
+
+#define DEMCR                        (*(volatile uint32_t*)0xE000EDFCU)
+#define DWT_CTRL                     (*(volatile uint32_t*)0xE0001000U)
+#define DWT_CYCCNT                   (*(volatile uint32_t*)0xE0001004U)
+
+#define SYST_CSR                     (*(volatile uint32_t*)0xE000E010U)
+#define SYST_RVR                     (*(volatile uint32_t*)0xE000E014U)
+#define SYST_CVR                     (*(volatile uint32_t*)0xE000E018U)
+
+#define SYSTICK_RELOAD               0x00FFFFFFU
+#define STACK_PAINT                  0xA5A5A5A5U
+#define MAX_RECORDS                  16
+#define REPORT_FORMAT_LEN            40
+
+/* 测量期间不向主机输出，缓冲区需要容纳单次调用的全部输出（mcu_test_suits.c 中最长的一次约 110 字节） */
+#define LINE_BUFFER_SIZE             256
+
+extern uint32_t _sstack;
+
+typedef struct {
+    const char* format;
+    uint32_t cycles;
+    uint32_t stack;
+    nva_ErrorCode code;
+} MeasureRecord;
+
+static char line_buffer[LINE_BUFFER_SIZE];
+static unsigned int line_len;
+static unsigned char measuring;
+static unsigned char line_overflow;
+
+static volatile uint32_t systick_overflow;
+
+static MeasureRecord records[MAX_RECORDS];
+static unsigned int record_count;
+static uint32_t measure_start;
+static uintptr_t measure_sp;
+
+static int semihostCall(int op, const void* arg)
+{
+    register int r0 __asm__("r0") = op;
+    register const void* r1 __asm__("r1") = arg;
+
+    __asm__ volatile("bkpt 0xAB" : "+r"(r0) : "r"(r1) : "memory");
+
+    return r0;
+}
+
+static void semihostExit(const int reason)
+{
+    (void)semihostCall(SEMIHOST_SYS_EXIT, (const void*)(uintptr_t)reason);
+}
+
+static void flushLine(void)
+{
+    if (line_len == 0U) {
+        return;
+    }
+
+    line_buffer[line_len] = '\0';
+    (void)semihostCall(SEMIHOST_SYS_WRITE0, line_buffer);
+    line_len = 0U;
+}
+
+/* 输出先写入内存，在测量区间外再交给主机，semihosting 的开销不计入结果 */
+int nva_putchar(const char c)
+{
+    if (line_len >= sizeof(line_buffer) - 1U) {
+        if (measuring) {
+            // 测量期间不能输出，这次测量记为失败，需要增大 LINE_BUFFER_SIZE
+            line_overflow = 1U;
+            return -1;
+        }
+        flushLine();
+    }
+
+    line_buffer[line_len++] = c;
+
+    return 1;
+}
+
+void SysTick_Handler(void)
+{
+    ++systick_overflow;
+}
+
+#ifdef NVA_QEMU_USE_DWT
+
+#define COUNTER_NAME "DWT CYCCNT (cycles)"
+
+static void counterInit(void)
+{
+    DEMCR |= (1U << 24);  // TRCENA
+    DWT_CYCCNT = 0U;
+    DWT_CTRL |= 1U;  // CYCCNTENA
+}
+
+static uint32_t counterRead(void)
+{
+    return DWT_CYCCNT;
+}
+
+#else
+
+#define COUNTER_NAME "SysTick (core clock ticks)"
+
+static void counterInit(void)
+{
+    SYST_RVR = SYSTICK_RELOAD;
+    SYST_CVR = 0U;
+    SYST_CSR = 0x07U;  // 处理器时钟，开启中断，开始计数
+}
+
+static uint32_t counterRead(void)
+{
+    uint32_t overflow;
+    uint32_t current;
+
+    do {
+        overflow = systick_overflow;
+        current = SYST_CVR;
+    } while (overflow != systick_overflow);
+
+    return overflow * (SYSTICK_RELOAD + 1U) + (SYSTICK_RELOAD - current);
+}
+
+#endif
+
+void nva_mcuMeasureBegin(const uintptr_t caller_sp)
+{
+    uintptr_t sp;
+
+    flushLine();
+
+    measure_sp = caller_sp;
+
+    // 把本函数栈帧以下的空闲栈全部填充为固定值，结束时查找被改写的最低地址。
+    // 填充期间屏蔽中断，避免 SysTick 的异常栈帧落在已经填充的区域
+    __asm__ volatile("cpsid i" : : : "memory");
+    sp = NVA_MCU_MEASURE_SP();
+    for (volatile uint32_t* p = &_sstack; (uintptr_t)p < sp; ++p) {
+        *p = STACK_PAINT;
+    }
+    __asm__ volatile("cpsie i" : : : "memory");
+
+    line_overflow = 0U;
+    measuring = 1U;
+    measure_start = counterRead();
+}
+
+nva_ErrorCode nva_mcuMeasureEnd(const char* const format, nva_ErrorCode code)
+{
+    const uint32_t cycles = counterRead() - measure_start;
+
+    measuring = 0U;
+    if (line_overflow) {
+        code = NVA_FAIL;
+    }
+
+    const volatile uint32_t* p = &_sstack;
+    while ((uintptr_t)p < measure_sp && *p == STACK_PAINT) {
+        ++p;
+    }
+
+    if (record_count < MAX_RECORDS) {
+        records[record_count].format = format;
+        records[record_count].cycles = cycles;
+        records[record_count].stack = (uint32_t)(measure_sp - (uintptr_t)p);
+        records[record_count].code = code;
+        ++record_count;
+    }
+
+    flushLine();
+
+    return code;
+}
+
+/* 报告中的格式字符串只保留一行 */
+static const char* reportFormat(const char* format, char* const buffer)
+{
+    unsigned int i = 0U;
+
+    for (; format[i] != '\0' && i < REPORT_FORMAT_LEN; ++i) {
+        buffer[i] = (format[i] == '\n') ? ' ' : format[i];
+    }
+    buffer[i] = '\0';
+
+    return buffer;
+}
+
+static void report(void)
+{
+    char format[REPORT_FORMAT_LEN + 1];
+    unsigned int i;
+
+    nva_print("\ncounter: {}\n", nva_str(COUNTER_NAME, NVA_START));
+    nva_print("{:>2}  {:>10}  {:>6}  {}\n",
+              nva_str("#", nva_str("cycles", nva_str("stack", nva_str("format", NVA_START)))));
+
+    for (i = 0U; i < record_count; ++i) {
+        nva_print("{:>2}  {:>10}  {:>6}  {}\n",
+                  nva_add(i,
+                          nva_add(records[i].cycles,
+                                  nva_add(records[i].stack,
+                                          nva_str(reportFormat(records[i].format, format), NVA_START)))));
+    }
+
+#ifdef NVA_QEMU_HIGH_WATER
+    // 参数栈与输出的峰值，用于确定 NVA_STACK_DEFAULT_SIZE 与缓冲区大小
+    (void)nva_highWaterDump();
+#endif
+
+    flushLine();
+}
+
+int main(void)
+{
+    unsigned int i;
+
+    counterInit();
+
+    nva_mcu_test_run();
+
+    report();
+
+    for (i = 0U; i < record_count; ++i) {
+        if (records[i].code != NVA_SUCCESS) {
+            semihostExit(ADP_STOPPED_RUNTIME_ERROR);
+        }
+    }
+
+    semihostExit(ADP_STOPPED_APPLICATION_EXIT);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file nva_mcu_measure.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief mcu_test_suits.c 的测量接口（Cortex-M）
+ *
+ * 定义 NVA_MCU_TEST_MEASURE 时由 mcu_test_suits.c 包含，每次 nva_print 调用前后分别调用 Begin 与 End。
+ */
+
+#ifndef NVA_MCU_MEASURE_H
+#define NVA_MCU_MEASURE_H
+
+#include <stdint.h>
+
+#include "nva/print.h"
+
+/* 在调用处展开，读取调用者自身的栈指针；栈用量从这里开始计算，不包含 nva_mcuMeasureBegin 的栈帧 */
+#define NVA_MCU_MEASURE_SP()                            \
+    __extension__({                                     \
+        uintptr_t nva_sp_;                              \
+        __asm__ volatile("mov %0, sp" : "=r"(nva_sp_)); \
+        nva_sp_;                                        \
+    })
+
+void nva_mcuMeasureBegin(uintptr_t caller_sp);
+
+nva_ErrorCode nva_mcuMeasureEnd(const char* format, nva_ErrorCode code);
+
+#endif /* !NVA_MCU_MEASURE_H */
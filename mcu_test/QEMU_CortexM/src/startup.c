@@ -0,0 +1,65 @@
+/**
+ * @file startup.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief Cortex-M 启动代码与中断向量表
+ */
+
+#include <stdint.h>
+
+extern uint32_t _sidata;
+extern uint32_t _sdata;
+extern uint32_t _edata;
+extern uint32_t _sbss;
+extern uint32_t _ebss;
+extern uint32_t _estack;
+
+int main(void);
+
+void Reset_Handler(void);
+void Default_Handler(void);
+void SysTick_Handler(void);
+
+void Reset_Handler(void)
+{
+    uint32_t* src = &_sidata;
+    uint32_t* dst = &_sdata;
+
+    while (dst < &_edata) {
+        *dst++ = *src++;
+    }
+
+    for (dst = &_sbss; dst < &_ebss; ++dst) {
+        *dst = 0U;
+    }
+
+    (void)main();
+
+    for (;;) {
+    }
+}
+
+void Default_Handler(void)
+{
+    for (;;) {
+    }
+}
+
+__attribute__((section(".isr_vector"), used)) static void (*const vector_table[16])(void) = {
+    (void (*)(void))(&_estack),
+    Reset_Handler,
+    Default_Handler,  // NMI
+    Default_Handler,  // HardFault
+    Default_Handler,  // MemManage
+    Default_Handler,  // BusFault
+    Default_Handler,  // UsageFault
+    0,
+    0,
+    0,
+    0,
+    Default_Handler,  // SVCall
+    Default_Handler,  // DebugMonitor
+    0,
+    Default_Handler,  // PendSV
+    SysTick_Handler,
+};
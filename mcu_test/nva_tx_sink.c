@@ -0,0 +1,106 @@
+/**
+ * @file nva_tx_sink.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 双缓冲发送输出端（中断/DMA 风格）
+ */
+
+#include "nva_tx_sink.h"
+
+/*
+ * tx_busy 与 tx_sending_len 由发送完成中断修改。单片机上中断与主循环在同一个核上交替执行，volatile 即可；
+ * 在主机上模拟时 nva_txSinkOnComplete 在另一个线程中调用，支持 C11 原子类型时使用原子变量
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define TX_SINK_SHARED _Atomic
+#else
+#define TX_SINK_SHARED volatile
+#endif
+
+static char tx_buffer[2][NVA_TX_SINK_HALF_SIZE];
+static unsigned int tx_fill_len;
+static unsigned char tx_fill_index;
+static TX_SINK_SHARED unsigned char tx_busy;
+static TX_SINK_SHARED unsigned int tx_sending_len;
+static unsigned int tx_peak;
+static unsigned int tx_stalls;
+
+static void txSinkKick(void)
+{
+    if (tx_busy) {
+        ++tx_stalls;
+    }
+
+    while (tx_busy) {
+        nva_txPortWait();
+    }
+
+    tx_busy = 1U;
+    tx_sending_len = tx_fill_len;
+    nva_txPortStart(tx_buffer[tx_fill_index], tx_fill_len);
+
+    tx_fill_index ^= 1U;
+    tx_fill_len = 0U;
+}
+
+void nva_txSinkInit(void)
+{
+    tx_fill_len = 0U;
+    tx_fill_index = 0U;
+    tx_busy = 0U;
+    tx_sending_len = 0U;
+    tx_peak = 0U;
+    tx_stalls = 0U;
+}
+
+int nva_txSinkPutchar(const char c)
+{
+    unsigned int pending;
+
+    tx_buffer[tx_fill_index][tx_fill_len++] = c;
+
+    /* 正在发送与等待发送的字节数之和 */
+    pending = tx_fill_len + tx_sending_len;
+    if (pending > tx_peak) {
+        tx_peak = pending;
+    }
+
+    if (tx_fill_len >= NVA_TX_SINK_HALF_SIZE) {
+        txSinkKick();
+    }
+
+    return 1;
+}
+
+void nva_txSinkFlush(void)
+{
+    if (tx_fill_len > 0U) {
+        txSinkKick();
+    }
+}
+
+void nva_txSinkDrain(void)
+{
+    nva_txSinkFlush();
+
+    while (tx_busy) {
+        nva_txPortWait();
+    }
+}
+
+void nva_txSinkOnComplete(void)
+{
+    tx_sending_len = 0U;
+    tx_busy = 0U;
+}
+
+unsigned int nva_txSinkPeak(void)
+{
+    return tx_peak;
+}
+
+unsigned int nva_txSinkStalls(void)
+{
+    return tx_stalls;
+}
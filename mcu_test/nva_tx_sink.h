@@ -0,0 +1,45 @@
+/**
+ * @file nva_tx_sink.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 双缓冲发送输出端（中断/DMA 风格）
+ *
+ * nva_putchar 把字符写入正在填充的半区，半区写满后交给外设发送，同时切换到另一个半区继续填充。
+ * 只有当两个半区都被占用时 CPU 才需要等待。
+ *
+ * 移植时需要实现下面两个端口函数，并在“发送完成”中断中调用 nva_txSinkOnComplete()。
+ */
+
+#ifndef NVA_TX_SINK_H
+#define NVA_TX_SINK_H
+
+#ifndef NVA_TX_SINK_HALF_SIZE
+#define NVA_TX_SINK_HALF_SIZE 32
+#endif
+
+/* 端口函数：启动一次发送（buf 在 nva_txSinkOnComplete 被调用前保持有效） */
+void nva_txPortStart(const char* buf, unsigned int len);
+
+/* 端口函数：上一个半区仍在发送时被反复调用，可在此休眠或让出 CPU */
+void nva_txPortWait(void);
+
+void nva_txSinkInit(void);
+
+int nva_txSinkPutchar(char c);
+
+/* 将未写满的半区交给外设发送 */
+void nva_txSinkFlush(void);
+
+/* 发送全部缓存内容，并等待外设空闲 */
+void nva_txSinkDrain(void);
+
+/* 在发送完成中断中调用 */
+void nva_txSinkOnComplete(void);
+
+/* 自初始化以来同时缓存（正在发送与等待发送）的最大字节数，最大为 2 * NVA_TX_SINK_HALF_SIZE */
+unsigned int nva_txSinkPeak(void);
+
+/* 两个半区都被占用、CPU 不得不等待的次数；不为 0 说明缓冲区偏小 */
+unsigned int nva_txSinkStalls(void);
+
+#endif /* !NVA_TX_SINK_H */
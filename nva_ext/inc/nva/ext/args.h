@@ -0,0 +1,56 @@
+/**
+ * @file args.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 批量压入参数与 va_list 入口
+ *
+ * 参数以“类型ID数组 + 值指针数组”给出，values[i] 指向一个与 types[i] 对应类型的值（字符串为 const char* 变量的地址）。
+ * va_list 入口的类型字符串与 Python struct 模块一致：b/B h/H i/I l/L q/Q 为有/无符号整型，c 字符，f/d 浮点，
+ * s 字符串，p 指针。
+ */
+
+#ifndef NVA_EXT_ARGS_H
+#define NVA_EXT_ARGS_H
+
+#include <stdarg.h>
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 按顺序把 n 个参数压入 stack，结果与依次调用 nva_stackPush 相同
+ *
+ * 先检查全部参数与剩余空间，再整块写入类型ID与参数值。类型ID无效或值为 NULL 时返回 NVA_PARAM_ERROR，
+ * 空间不足时返回 NVA_FAIL，这两种情况下栈都保持不变
+ */
+nva_ErrorCode nva_stackPushArgs(nva_Stack* stack, const nva_TypeId* types, const void* const* values, nva_Size n);
+
+/**
+ * @brief 把 n 个参数压入格式化参数链，values[i] 对应格式中的 {i}，next 中已有的参数排在它们之后
+ *
+ * 参数链所在的栈是 nva_print 内部的，公开接口中只能经由 nva_int 等函数逐个压入，因此这里无法整块拷贝；
+ * 需要整块拷贝时请使用 nva_stackPushArgs。
+ * 参数无效或类型ID不被支持时返回 NVA_ERROR，之后的 nva_format/nva_print 返回失败
+ */
+nva_ErrorCode nva_pushArgs(const nva_TypeId* types, const void* const* values, nva_Size n, nva_ErrorCode next);
+
+/**
+ * @brief 以类型字符串与 va_list 给出参数的 nva_format，便于转发已有的 printf 风格封装
+ *
+ * 类型字符串中出现未知字符时返回 NVA_PARAM_ERROR，不会压入任何参数
+ */
+nva_ErrorCode nva_vformat(char* dst, const char* format, const char* types, va_list args);
+
+/**
+ * @brief 以类型字符串与 va_list 给出参数的 nva_print
+ */
+nva_ErrorCode nva_vprint(const char* format, const char* types, va_list args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_ARGS_H */
@@ -0,0 +1,46 @@
+/**
+ * @file bytes.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 字节块的十六进制、hexdump 与 base64 编码
+ *
+ * 一次调用编码整个字节块，支持 SSE2/SSSE3 时每步处理 16 字节（base64 每步 12 字节），否则查表逐字节编码。
+ * 结果以 '\0' 结尾，可以再以 nva_str/nva_strn 交给 nva_format。dst 的大小由下面的宏给出。
+ */
+
+#ifndef NVA_EXT_BYTES_H
+#define NVA_EXT_BYTES_H
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 每行 16 字节：8 位偏移、两个空格、两组 8 个 "hh "、组间一个空格、" |"、16 个字符与 "|\n" */
+#define NVA_HEXDUMP_LINE_LEN  79U
+
+#define NVA_HEX_SIZE(len)     (2U * (len) + 1U)
+#define NVA_HEXDUMP_SIZE(len) (((len) + 15U) / 16U * NVA_HEXDUMP_LINE_LEN + 1U)
+#define NVA_BASE64_SIZE(len)  (((len) + 2U) / 3U * 4U + 1U)
+
+/**
+ * @brief 把 len 个字节编码为连续的十六进制（每字节两位，没有分隔符），返回写入的长度（不含 '\0'）
+ */
+nva_Size nva_hexEncode(char* dst, const void* src, nva_Size len, int upper_case);
+
+/**
+ * @brief 按 hexdump -C 的行格式输出偏移、十六进制与可打印字符三栏，不输出最后的总长度行
+ */
+nva_Size nva_hexdump(char* dst, const void* src, nva_Size len);
+
+/**
+ * @brief 按 RFC 4648 标准字母表编码为 base64，带 '=' 填充
+ */
+nva_Size nva_base64Encode(char* dst, const void* src, nva_Size len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_BYTES_H */
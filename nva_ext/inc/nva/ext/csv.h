@@ -0,0 +1,110 @@
+/**
+ * @file csv.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 按列模式写出 CSV/TSV 行
+ *
+ * 每一列给出名称、类型ID与格式规格（与 {:spec} 中冒号之后的部分相同），规格只在初始化时解析一次。
+ * 整数、浮点数、字符与字符串列的常见规格在初始化时解码为转换属性，每行直接调用 nva_itoa/nva_uitoa/nva_fptoa
+ * 或逐位转换 long/long long；以下规格每行调用一次只含该字段的 nva_format：省略类型字符或使用 e/E/% 的浮点数、
+ * 指针、带 '#' 或精度的整数、非十进制的有符号整数、带符号的无符号整数，以及补零与显式对齐同时出现的规格。
+ * 字段含有分隔符、'"'、'\n' 或 '\r' 时按 RFC 4180 用引号包围，内部的引号加倍；行以 "\r\n" 结尾。
+ * 整行写入输出缓冲区，缓冲区放不下下一行时先整块刷出。
+ */
+
+#ifndef NVA_EXT_CSV_H
+#define NVA_EXT_CSV_H
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 一个写出器支持的最大列数 */
+#ifndef NVA_CSV_MAX_COLUMNS
+#define NVA_CSV_MAX_COLUMNS 32U
+#endif
+
+/* 逐字段调用 nva_format 时格式字符串 "{:spec}" 的最大长度，含 '\0' */
+#ifndef NVA_CSV_FORMAT_SIZE
+#define NVA_CSV_FORMAT_SIZE 16U
+#endif
+
+typedef struct {
+    const char* name;
+    nva_TypeId type;
+    const char* spec; /* 不含冒号的格式规格，"" 表示 {} */
+} nva_CsvColumn;
+
+/* 初始化时由列的规格解析得到，使用者不需要访问 */
+typedef struct {
+    unsigned char kind;
+    unsigned char zero; /* 在符号之后补 0 到 width */
+    char sign;          /* '+'、' '，或 '-' 表示非负数不加符号 */
+    char fill;
+    char align;
+    nva_Size width;
+    union {
+        nva_NumToStringAttr num;
+        nva_FloatPointToStrAttr fp;
+    } attr;
+    char format[NVA_CSV_FORMAT_SIZE];
+} nva_CsvField;
+
+/**
+ * @brief 刷出回调：把 [buf, buf + len) 写到最终的输出端，返回 NVA_SUCCESS 表示成功
+ */
+typedef nva_ErrorCode (*nva_CsvFlushFn)(void* ctx, const char* buf, nva_Size len);
+
+typedef struct {
+    const nva_CsvColumn* columns;
+    nva_Size count;
+    char separator;
+    char* buf;
+    nva_Size len;
+    nva_Size cap;
+    nva_CsvFlushFn flush;
+    void* ctx;
+    nva_CsvField fields[NVA_CSV_MAX_COLUMNS];
+} nva_CsvWriter;
+
+/**
+ * @brief 以 count 列的模式与输出缓冲区 [buf, buf + cap) 初始化 writer
+ *
+ * columns 在 writer 使用期间必须保持有效。参数无效或列数超过 NVA_CSV_MAX_COLUMNS 时返回 NVA_PARAM_ERROR；
+ * 规格无法解析、含有位置参数或与列的类型不符时返回 NVA_FAIL
+ */
+nva_ErrorCode nva_csvWriterInit(nva_CsvWriter* writer,
+                                const nva_CsvColumn* columns,
+                                nva_Size count,
+                                char separator,
+                                char* buf,
+                                nva_Size cap,
+                                nva_CsvFlushFn flush,
+                                void* ctx);
+
+/**
+ * @brief 写出由列名组成的表头行
+ */
+nva_ErrorCode nva_csvWriteHeader(nva_CsvWriter* writer);
+
+/**
+ * @brief 写出一行，values[i] 指向一个与第 i 列类型对应的值（字符串为 const char* 变量的地址）
+ *
+ * 整行超过缓冲区容量或格式化失败时返回 NVA_FAIL，该行的任何部分都不会写出；刷出失败时返回回调的结果
+ */
+nva_ErrorCode nva_csvWriteRow(nva_CsvWriter* writer, const void* const* values);
+
+/**
+ * @brief 刷出缓冲区中的全部内容，缓冲区为空时不调用回调
+ *
+ * 回调失败时返回其结果，缓冲区内容保留，可以再次刷出
+ */
+nva_ErrorCode nva_csvFlush(nva_CsvWriter* writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_CSV_H */
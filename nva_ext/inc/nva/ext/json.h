@@ -0,0 +1,45 @@
+/**
+ * @file json.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief JSON 字符串转义与 JSON 行输出
+ *
+ * 参数以“类型ID数组 + 值指针数组”给出，与 nva/ext/args.h 相同。
+ */
+
+#ifndef NVA_EXT_JSON_H
+#define NVA_EXT_JSON_H
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 把 src 的前 len 个字节按 JSON 字符串的规则转义后写入 dst，以 '\0' 结尾，返回写入的长度（不含 '\0'）
+ *
+ * 转义 '"'、'\\' 与小于 0x20 的控制字符，不添加引号；其他字节（含 UTF-8 多字节序列）原样输出。
+ * dst 至少需要 6 * len + 1 字节。支持 SSE2 时每次检查 16 字节，不需要转义的连续字节整段拷贝
+ */
+nva_Size nva_jsonEscape(char* dst, const char* src, nva_Size len);
+
+/**
+ * @brief 由键名与参数生成一个 JSON 对象 {"key":value,...}，写入容量为 cap 字节（含 '\0'）的 dst
+ *
+ * 字符串与字符输出为转义后的 JSON 字符串，指针输出为字符串，整数与浮点数按 {} 输出，非有限的浮点数输出 null；
+ * nva_print 提供 nva_strn 时同样接受 NVA_TYPEID_STRN。dst 为 NULL 或 cap 为 0 时返回 NVA_PARAM_ERROR，
+ * 其他失败时 dst 为空字符串：键名或值为 NULL 时返回 NVA_PARAM_ERROR，放不下、类型ID不被支持或格式化失败时返回 NVA_FAIL
+ */
+nva_ErrorCode nva_formatJsonArgs(char* dst,
+                                 nva_Size cap,
+                                 const char* const* keys,
+                                 const nva_TypeId* types,
+                                 const void* const* values,
+                                 nva_Size n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_JSON_H */
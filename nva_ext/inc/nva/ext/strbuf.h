@@ -0,0 +1,72 @@
+/**
+ * @file strbuf.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 记录长度的字符串构建器
+ *
+ * nva_StrBuf 记录当前长度，追加时不再重新扫描已有内容；buf 始终以 '\0' 结尾。
+ * 空间不足时追加失败并返回 NVA_FAIL，已有内容保持不变，不会越过 cap 写入。
+ */
+
+#ifndef NVA_EXT_STRBUF_H
+#define NVA_EXT_STRBUF_H
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    char* buf;
+    nva_Size len; /* 不含结尾的 '\0' */
+    nva_Size cap; /* buf 的总字节数，含结尾的 '\0' */
+} nva_StrBuf;
+
+/**
+ * @brief 以 [buf, buf + cap) 初始化 sb，内容为空串
+ *
+ * cap 至少为 1，用于存放 '\0'
+ */
+nva_ErrorCode nva_strBufInit(nva_StrBuf* sb, char* buf, nva_Size cap);
+
+/**
+ * @brief 清空内容，保留缓冲区
+ */
+void nva_strBufClear(nva_StrBuf* sb);
+
+nva_ErrorCode nva_strBufAppendStr(nva_StrBuf* sb, const char* str);
+
+nva_ErrorCode nva_strBufAppendChar(nva_StrBuf* sb, char c);
+
+/**
+ * @brief 追加整数，attr 为 NULL 时按十进制输出
+ */
+nva_ErrorCode nva_strBufAppendInt(nva_StrBuf* sb, int value, const nva_NumToStringAttr* attr);
+
+nva_ErrorCode nva_strBufAppendUint(nva_StrBuf* sb, unsigned int value, const nva_NumToStringAttr* attr);
+
+/**
+ * @brief 追加浮点数，attr 为 NULL 时按 {:f} 输出
+ */
+nva_ErrorCode nva_strBufAppendFloat(nva_StrBuf* sb, double value, const nva_FloatPointToStrAttr* attr);
+
+/* nva_strBufAppendFormat 单次格式化结果的最大字节数，含结尾的 '\0' */
+#ifndef NVA_STRBUF_FORMAT_SIZE
+#define NVA_STRBUF_FORMAT_SIZE 256
+#endif
+
+/**
+ * @brief 以 nva_format 的语法追加格式化结果
+ *
+ * 剩余空间不少于 NVA_STRBUF_FORMAT_SIZE 时直接写在末尾，否则先写入静态暂存区，确定长度后再复制；
+ * 空间不足时返回 NVA_FAIL，内容不变。单次结果不能超过 NVA_STRBUF_FORMAT_SIZE - 1 个字符。
+ * 与 nva_format 一样不可重入
+ */
+nva_ErrorCode nva_strBufAppendFormat(nva_StrBuf* sb, const char* format, nva_ErrorCode status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_STRBUF_H */
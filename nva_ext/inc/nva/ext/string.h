@@ -0,0 +1,126 @@
+/**
+ * @file string.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief nva/string.h 之外的内存操作函数
+ *
+ * 只在 [ptr, ptr + n) 内读写，不会越过页边界；定义了 NVA_NO_STRING_H 的平台同样可用。
+ */
+
+#ifndef NVA_EXT_STRING_H
+#define NVA_EXT_STRING_H
+
+#include "nva/string.h"
+
+/* 低于此尺寸的 nva_memcpyParallel/nva_memmoveParallel 不切分，直接在调用者的线程中完成 */
+#ifndef NVA_PARALLEL_COPY_THRESHOLD
+#define NVA_PARALLEL_COPY_THRESHOLD (8UL * 1024UL * 1024UL)
+#endif
+
+/* 并行拷贝使用的最大线程数（含调用者） */
+#ifndef NVA_PARALLEL_COPY_MAX_THREADS
+#define NVA_PARALLEL_COPY_MAX_THREADS 16
+#endif
+
+/**
+ * @brief 尺寸为编译期常量的拷贝，n 为 1、2、4、8、16 时展开为按字节或按字的非对齐读写，其他尺寸调用 nva_memcpy
+ *
+ * 可以作为单条语句使用，dst 与 src 只求值一次。不经过 __builtin_memcpy，定义了 NVA_NO_STRING_H 时也不会调用 libc；
+ * 不支持 GNU 扩展的编译器上，16 字节以内逐字节拷贝
+ */
+#ifdef __GNUC__
+/* 按 1 字节对齐、允许与任意类型别名的字，用于 NVA_MEMCPY_CONST 的单次读写 */
+typedef __UINT16_TYPE__ nva_MemcpyU16 __attribute__((__may_alias__, __aligned__(1)));
+typedef __UINT32_TYPE__ nva_MemcpyU32 __attribute__((__may_alias__, __aligned__(1)));
+typedef __UINT64_TYPE__ nva_MemcpyU64 __attribute__((__may_alias__, __aligned__(1)));
+
+#define NVA_MEMCPY_WORD_(d, s, type) (*(type*)(void*)(d) = *(const type*)(const void*)(s))
+
+#define NVA_MEMCPY_CONST(dst, src, n)                                                      \
+    do {                                                                                   \
+        unsigned char* const nva_memcpy_dst_ = (unsigned char*)(dst);                      \
+        const unsigned char* const nva_memcpy_src_ = (const unsigned char*)(src);          \
+        if ((n) == 1U) {                                                                   \
+            *nva_memcpy_dst_ = *nva_memcpy_src_;                                           \
+        }                                                                                  \
+        else if ((n) == 2U) {                                                              \
+            NVA_MEMCPY_WORD_(nva_memcpy_dst_, nva_memcpy_src_, nva_MemcpyU16);             \
+        }                                                                                  \
+        else if ((n) == 4U) {                                                              \
+            NVA_MEMCPY_WORD_(nva_memcpy_dst_, nva_memcpy_src_, nva_MemcpyU32);             \
+        }                                                                                  \
+        else if ((n) == 8U || (n) == 16U) {                                                \
+            NVA_MEMCPY_WORD_(nva_memcpy_dst_, nva_memcpy_src_, nva_MemcpyU64);             \
+            if ((n) == 16U) {                                                              \
+                NVA_MEMCPY_WORD_(nva_memcpy_dst_ + 8, nva_memcpy_src_ + 8, nva_MemcpyU64); \
+            }                                                                              \
+        }                                                                                  \
+        else {                                                                             \
+            nva_memcpy(nva_memcpy_dst_, nva_memcpy_src_, (n));                             \
+        }                                                                                  \
+    } while (0)
+#else
+#define NVA_MEMCPY_CONST(dst, src, n)                                                  \
+    do {                                                                               \
+        unsigned char* const nva_memcpy_dst_ = (unsigned char*)(dst);                  \
+        const unsigned char* const nva_memcpy_src_ = (const unsigned char*)(src);      \
+        if ((n) <= 16U) {                                                              \
+            nva_Size nva_memcpy_i_;                                                    \
+            for (nva_memcpy_i_ = 0U; nva_memcpy_i_ < (nva_Size)(n); ++nva_memcpy_i_) { \
+                nva_memcpy_dst_[nva_memcpy_i_] = nva_memcpy_src_[nva_memcpy_i_];       \
+            }                                                                          \
+        }                                                                              \
+        else {                                                                         \
+            nva_memcpy(nva_memcpy_dst_, nva_memcpy_src_, (n));                         \
+        }                                                                              \
+    } while (0)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 按无符号字节比较 lhs 与 rhs 的前 n 个字节，返回值的符号与 memcmp 相同
+ *
+ * 支持 SSE2 时每次比较 16 字节，否则在两侧对齐相同时每次比较一个字
+ */
+int nva_memcmp(const void* lhs, const void* rhs, nva_Size n);
+
+/**
+ * @brief 把 dst 的前 n 个字节设为 (unsigned char)c，返回 dst
+ *
+ * 先逐字节对齐，再按字（支持 SSE2 时按 16 字节）写入
+ */
+void* nva_memset(void* dst, int c, nva_Size n);
+
+/**
+ * @brief 在 src 的前 n 个字节中查找 (unsigned char)c，返回第一次出现的位置，没有时返回 NULL
+ */
+void* nva_memchr(const void* src, int c, nva_Size n);
+
+/**
+ * @brief 查找 (unsigned char)c1 或 (unsigned char)c2 中先出现的一个，如格式字符串中的 '{' 与 '}'
+ */
+void* nva_memchr2(const void* src, int c1, int c2, nva_Size n);
+
+/**
+ * @brief 把 n 字节的拷贝切分到 threads 个线程，threads 为 0 时使用在线的处理器数，返回 dst
+ *
+ * n 低于 NVA_PARALLEL_COPY_THRESHOLD 或没有 pthread 时等价于 nva_memcpy。工作线程在第一次切分时创建并常驻，
+ * 多个调用者可以同时使用，各自的块排队共享这些线程，调用者也参与拷贝并在全部完成后返回
+ */
+void* nva_memcpyParallel(void* dst, const void* src, nva_Size n, unsigned int threads);
+
+/**
+ * @brief 允许重叠的 nva_memcpyParallel
+ *
+ * 按源与目的的地址差分段依次处理，每段内部并行；地址差低于阈值时等价于 nva_memmove
+ */
+void* nva_memmoveParallel(void* dst, const void* src, nva_Size n, unsigned int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_STRING_H */
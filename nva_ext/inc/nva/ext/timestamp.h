@@ -0,0 +1,50 @@
+/**
+ * @file timestamp.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 日志行时间戳前缀 YYYY-MM-DD HH:MM:SS.uuuuuu（UTC）
+ *
+ * nva_TimestampCache 保存最近一次生成的日期与时分秒，同一秒内的调用只改写微秒部分。
+ * 缓存不加锁，每个线程（或每个日志输出端）各自持有一份。
+ */
+
+#ifndef NVA_EXT_TIMESTAMP_H
+#define NVA_EXT_TIMESTAMP_H
+
+#include "nva/print.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 时间戳的长度，不含 '\0' */
+#define NVA_TIMESTAMP_LEN              26U
+
+/* "YYYY-MM-DD HH:MM:SS." 的长度 */
+#define NVA_TIMESTAMP_SECOND_LEN       20U
+
+#define NVA_TIMESTAMP_CACHE_INIT_VALUE {0U, 0U, {0}}
+
+typedef struct {
+    unsigned long long sec;
+    unsigned char valid;
+    char text[NVA_TIMESTAMP_SECOND_LEN]; /* 秒级部分，不以 '\0' 结尾 */
+} nva_TimestampCache;
+
+/**
+ * @brief 使缓存失效，下一次调用重新生成日期与时分秒
+ */
+nva_ErrorCode nva_timestampCacheInit(nva_TimestampCache* cache);
+
+/**
+ * @brief 把 Unix 时间 sec 秒 usec 微秒写入 dst，共 NVA_TIMESTAMP_LEN 个字符并以 '\0' 结尾
+ *
+ * usec 不小于 1000000 时返回 NVA_PARAM_ERROR；超出 9999-12-31 23:59:59 时返回 NVA_FAIL，缓存不变
+ */
+nva_ErrorCode nva_timestampRender(nva_TimestampCache* cache, unsigned long long sec, unsigned long usec, char* dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !NVA_EXT_TIMESTAMP_H */
@@ -0,0 +1,273 @@
+/**
+ * @file args.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 批量压入参数与 va_list 入口
+ */
+
+#include "nva/ext/args.h"
+
+/* 从 va_list 中取出、等待压入的一个参数 */
+typedef union {
+    int i;
+    unsigned int u;
+    long l;
+    unsigned long ul;
+    long long ll;
+    unsigned long long ull;
+    double d;
+    const char* s;
+    const void* p;
+} ExtVaValue;
+
+static nva_ErrorCode extPushValue(const nva_TypeId type, const void* const value, const nva_ErrorCode next)
+{
+    if (!value) {
+        return NVA_ERROR;
+    }
+
+    switch (type) {
+    case NVA_TYPEID_CHAR:
+        return nva_char(*(const char*)value, next);
+    case NVA_TYPEID_SCHAR:
+        return nva_schar(*(const signed char*)value, next);
+    case NVA_TYPEID_UCHAR:
+        return nva_uchar(*(const unsigned char*)value, next);
+    case NVA_TYPEID_SSHORT:
+        return nva_short(*(const short*)value, next);
+    case NVA_TYPEID_USHORT:
+        return nva_ushort(*(const unsigned short*)value, next);
+    case NVA_TYPEID_SINT:
+        return nva_int(*(const int*)value, next);
+    case NVA_TYPEID_UINT:
+        return nva_uint(*(const unsigned int*)value, next);
+    case NVA_TYPEID_SLONG:
+        return nva_long(*(const long*)value, next);
+    case NVA_TYPEID_ULONG:
+        return nva_ulong(*(const unsigned long*)value, next);
+    case NVA_TYPEID_SLLONG:
+        return nva_llong(*(const long long*)value, next);
+    case NVA_TYPEID_ULLONG:
+        return nva_ullong(*(const unsigned long long*)value, next);
+    case NVA_TYPEID_PTR:
+        return nva_ptr(*(const void* const*)value, next);
+    case NVA_TYPEID_FLOAT:
+        return nva_float(*(const float*)value, next);
+    case NVA_TYPEID_DOUBLE:
+        return nva_double(*(const double*)value, next);
+    case NVA_TYPEID_STR:
+        return nva_str(*(const char* const*)value, next);
+#ifdef NVA_EXT_WITH_STRN
+    case NVA_TYPEID_STRN:
+        return nva_strn(((const nva_StrView*)value)->ptr, ((const nva_StrView*)value)->len, next);
+#endif
+    default:
+        return NVA_ERROR;
+    }
+}
+
+/* 按类型字符从 args 中取出一个参数，未知字符返回 0 */
+static int extVaRead(const char type, va_list* const args, ExtVaValue* const value)
+{
+    switch (type) {
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'c':
+        value->i = va_arg(*args, int);
+        return 1;
+    case 'B':
+    case 'H':
+    case 'I':
+        value->u = va_arg(*args, unsigned int);
+        return 1;
+    case 'l':
+        value->l = va_arg(*args, long);
+        return 1;
+    case 'L':
+        value->ul = va_arg(*args, unsigned long);
+        return 1;
+    case 'q':
+        value->ll = va_arg(*args, long long);
+        return 1;
+    case 'Q':
+        value->ull = va_arg(*args, unsigned long long);
+        return 1;
+    case 'f':
+    case 'd':
+        value->d = va_arg(*args, double);
+        return 1;
+    case 's':
+        value->s = va_arg(*args, const char*);
+        return 1;
+    case 'p':
+        value->p = va_arg(*args, const void*);
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static nva_ErrorCode extVaPush(const char type, const ExtVaValue* const value, const nva_ErrorCode next)
+{
+    switch (type) {
+    case 'b':
+        return nva_schar((signed char)value->i, next);
+    case 'B':
+        return nva_uchar((unsigned char)value->u, next);
+    case 'h':
+        return nva_short((short)value->i, next);
+    case 'H':
+        return nva_ushort((unsigned short)value->u, next);
+    case 'i':
+        return nva_int(value->i, next);
+    case 'I':
+        return nva_uint(value->u, next);
+    case 'c':
+        return nva_char((char)value->i, next);
+    case 'l':
+        return nva_long(value->l, next);
+    case 'L':
+        return nva_ulong(value->ul, next);
+    case 'q':
+        return nva_llong(value->ll, next);
+    case 'Q':
+        return nva_ullong(value->ull, next);
+    case 'f':
+        return nva_float((float)value->d, next);
+    case 'd':
+        return nva_double(value->d, next);
+    case 's':
+        return nva_str(value->s, next);
+    case 'p':
+        return nva_ptr(value->p, next);
+    default:
+        return NVA_PARAM_ERROR;
+    }
+}
+
+/*
+ * 第一个参数需要最后压入才对应 {0}，而 va_list 只能顺序读取：从最后一个参数开始，每次从头跳过它之前的参数。
+ * 类型字符串通常只有几个字符，重复读取的代价很小，占用的栈空间与参数个数无关
+ */
+static nva_ErrorCode extPushTypedVaList(const char* const types, va_list args)
+{
+    ExtVaValue value;
+    va_list copy;
+    nva_Size n;
+    nva_Size i;
+    nva_ErrorCode next = NVA_START;
+    int known = 1;
+
+    /* 先检查整个类型字符串，含有未知字符时不压入任何参数 */
+    va_copy(copy, args);
+    for (n = 0U; known && types[n] != '\0'; ++n) {
+        known = extVaRead(types[n], &copy, &value);
+    }
+    va_end(copy);
+    if (!known) {
+        return NVA_PARAM_ERROR;
+    }
+
+    while (n > 0U && next == NVA_START) {
+        va_copy(copy, args);
+        for (i = 0U; i < n; ++i) {
+            (void)extVaRead(types[i], &copy, &value);
+        }
+        va_end(copy);
+
+        --n;
+        next = extVaPush(types[n], &value, next);
+    }
+
+    return next;
+}
+
+nva_ErrorCode nva_stackPushArgs(nva_Stack* const stack,
+                                const nva_TypeId* const types,
+                                const void* const* const values,
+                                const nva_Size n)
+{
+    unsigned char* data;
+    nva_Size size = 0U;
+    nva_Size i;
+
+    if (!stack || (n > 0U && (!types || !values))) {
+        return NVA_PARAM_ERROR;
+    }
+
+    /* 先检查全部参数并计算总大小，空间足够时才写入：全部成功或全部不压入 */
+    for (i = 0U; i < n; ++i) {
+        if (!values[i] || NVA_TYPE_SIZE(types[i]) == 0U) {
+            return NVA_PARAM_ERROR;
+        }
+        size += NVA_TYPE_SIZE(types[i]);
+    }
+    if (n > NVA_COUNTOF(stack->type) - (nva_Size)stack->type_top ||
+        size > sizeof(stack->data_store) - (nva_Size)stack->data_top) {
+        return NVA_FAIL;
+    }
+
+    /* 类型ID整块拷贝，参数值按与 nva_stackPush 相同的布局依次写入 data_store */
+    nva_memcpy(stack->type + stack->type_top, types, n * sizeof(nva_TypeId));
+    data = stack->data_store + stack->data_top;
+    for (i = 0U; i < n; ++i) {
+        nva_memcpy(data, values[i], NVA_TYPE_SIZE(types[i]));
+        data += NVA_TYPE_SIZE(types[i]);
+    }
+
+    stack->type_top += n;
+    stack->data_top += size;
+
+    return NVA_SUCCESS;
+}
+
+nva_ErrorCode nva_pushArgs(const nva_TypeId* const types,
+                           const void* const* const values,
+                           nva_Size n,
+                           nva_ErrorCode next)
+{
+    if (n > 0U && (!types || !values)) {
+        return NVA_ERROR;
+    }
+
+    /* 逆序压入，values[0] 最后压入，对应 {0} */
+    while (n > 0U) {
+        --n;
+        next = extPushValue(types[n], values[n], next);
+    }
+
+    return next;
+}
+
+nva_ErrorCode nva_vformat(char* const dst, const char* const format, const char* const types, va_list args)
+{
+    nva_ErrorCode code;
+
+    if (!dst || !types) {
+        return NVA_PARAM_ERROR;
+    }
+
+    code = extPushTypedVaList(types, args);
+    if (code == NVA_PARAM_ERROR) {
+        return code;
+    }
+
+    return nva_format(dst, format, code);
+}
+
+nva_ErrorCode nva_vprint(const char* const format, const char* const types, va_list args)
+{
+    nva_ErrorCode code;
+
+    if (!types) {
+        return NVA_PARAM_ERROR;
+    }
+
+    code = extPushTypedVaList(types, args);
+    if (code == NVA_PARAM_ERROR) {
+        return code;
+    }
+
+    return nva_print(format, code);
+}
@@ -0,0 +1,220 @@
+/**
+ * @file bytes.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 字节块的十六进制、hexdump 与 base64 编码
+ */
+
+#include "nva/ext/bytes.h"
+
+#include "simd.h"
+
+static const char ext_hex_lower[] = "0123456789abcdef";
+static const char ext_hex_upper[] = "0123456789ABCDEF";
+static const char ext_base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#ifdef NVA_EXT_SSE2
+
+/* 把 0~15 的半字节转换为十六进制字符 */
+static __m128i extHexDigits(const __m128i nibbles, const int upper_case)
+{
+#ifdef NVA_EXT_SSSE3
+    const __m128i table = _mm_loadu_si128((const __m128i*)(upper_case ? ext_hex_upper : ext_hex_lower));
+
+    return _mm_shuffle_epi8(table, nibbles);
+#else
+    /* 大于 9 的半字节再加上 'a' - '0' - 10 或 'A' - '0' - 10 */
+    const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                        _mm_set1_epi8(upper_case ? 'A' - '0' - 10 : 'a' - '0' - 10));
+
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), alpha);
+#endif
+}
+
+/* 编码 16 字节，写出 32 个字符 */
+static void extHex16(char* const dst, const unsigned char* const src, const int upper_case)
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i x = _mm_loadu_si128((const __m128i*)src);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    const __m128i lo = _mm_and_si128(x, mask);
+
+    _mm_storeu_si128((__m128i*)dst, extHexDigits(_mm_unpacklo_epi8(hi, lo), upper_case));
+    _mm_storeu_si128((__m128i*)(dst + 16), extHexDigits(_mm_unpackhi_epi8(hi, lo), upper_case));
+}
+
+#else
+
+static void extHex16(char* const dst, const unsigned char* const src, const int upper_case)
+{
+    const char* const digits = upper_case ? ext_hex_upper : ext_hex_lower;
+    unsigned int i;
+
+    for (i = 0U; i < 16U; ++i) {
+        dst[2U * i] = digits[src[i] >> 4U];
+        dst[2U * i + 1U] = digits[src[i] & 0x0FU];
+    }
+}
+
+#endif /* NVA_EXT_SSE2 */
+
+nva_Size nva_hexEncode(char* const dst, const void* const src, const nva_Size len, const int upper_case)
+{
+    const char* const digits = upper_case ? ext_hex_upper : ext_hex_lower;
+    const unsigned char* s = (const unsigned char*)src;
+    const unsigned char* const end = s + len;
+    char* d = dst;
+
+    for (; end - s >= 16; s += 16U, d += 32U) {
+        extHex16(d, s, upper_case);
+    }
+    for (; s < end; ++s) {
+        *d++ = digits[*s >> 4U];
+        *d++ = digits[*s & 0x0FU];
+    }
+
+    *d = '\0';
+    return (nva_Size)(d - dst);
+}
+
+/* 可打印字符原样输出，其余输出 '.' */
+static void extHexdumpAscii(char* const dst, const unsigned char* const src, const nva_Size n)
+{
+    nva_Size i = 0U;
+
+#ifdef NVA_EXT_SSE2
+    if (n == 16U) {
+        /* 按有符号比较，0x80 以上的字节为负数，不大于 0x1F */
+        const __m128i x = _mm_loadu_si128((const __m128i*)src);
+        const __m128i printable = _mm_andnot_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(0x7F)),
+                                                   _mm_cmpgt_epi8(x, _mm_set1_epi8(0x1F)));
+
+        _mm_storeu_si128((__m128i*)dst,
+                         _mm_or_si128(_mm_and_si128(printable, x), _mm_andnot_si128(printable, _mm_set1_epi8('.'))));
+        return;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        dst[i] = (src[i] >= 0x20U && src[i] < 0x7FU) ? (char)src[i] : '.';
+    }
+}
+
+nva_Size nva_hexdump(char* const dst, const void* const src, const nva_Size len)
+{
+    const unsigned char* const data = (const unsigned char*)src;
+    char hex[32];
+    char* d = dst;
+    nva_Size offset;
+
+    for (offset = 0U; offset < len; offset += 16U) {
+        const nva_Size n = (len - offset < 16U) ? len - offset : 16U;
+        unsigned int i;
+        int shift;
+
+        /* 偏移固定输出 8 位，超出 nva_Size 位数的高位补 0，16 位的 nva_Size 不会移位越界 */
+        for (shift = 28; shift >= 0; shift -= 4) {
+            *d++ = ((unsigned int)shift < sizeof(nva_Size) * 8U) ? ext_hex_lower[(offset >> shift) & 0x0FU] : '0';
+        }
+        *d++ = ' ';
+        *d++ = ' ';
+
+        if (n == 16U) {
+            extHex16(hex, data + offset, 0);
+        }
+        else {
+            (void)nva_hexEncode(hex, data + offset, n, 0);
+        }
+
+        /* 不足 16 字节的行以空格补齐十六进制栏 */
+        for (i = 0U; i < 16U; ++i) {
+            if (i < n) {
+                d[0] = hex[2U * i];
+                d[1] = hex[2U * i + 1U];
+            }
+            else {
+                d[0] = ' ';
+                d[1] = ' ';
+            }
+            d[2] = ' ';
+            d += 3U;
+            if (i == 7U) {
+                *d++ = ' ';
+            }
+        }
+
+        *d++ = ' ';
+        *d++ = '|';
+        extHexdumpAscii(d, data + offset, n);
+        d += n;
+        *d++ = '|';
+        *d++ = '\n';
+    }
+
+    *d = '\0';
+    return (nva_Size)(d - dst);
+}
+
+nva_Size nva_base64Encode(char* const dst, const void* const src, const nva_Size len)
+{
+    const unsigned char* s = (const unsigned char*)src;
+    const unsigned char* const end = s + len;
+    char* d = dst;
+
+#ifdef NVA_EXT_SSSE3
+    /* 每步读取 16 字节、使用其中 12 字节，写出 16 个字符 */
+    const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    /* 6 位下标到字符的偏移：0~25 为 'A'，26~51 为 'a' - 26，52~61 为 '0' - 52，62 为 '+'，63 为 '/' */
+    const __m128i offsets = _mm_setr_epi8('a' - 26,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62,
+                                          '/' - 63,
+                                          'A',
+                                          0,
+                                          0);
+
+    for (; end - s >= 16; s += 12U, d += 16U) {
+        const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)s), shuffle);
+        /* 每 3 字节拆为 4 个 6 位下标，各占一个字节 */
+        const __m128i hi = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i lo = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(hi, lo);
+        /* 52~63 映射为 1~12，0~25 映射为 13，26~51 映射为 0 */
+        const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13));
+        const __m128i range = _mm_or_si128(_mm_subs_epu8(indices, _mm_set1_epi8(51)), letters);
+
+        _mm_storeu_si128((__m128i*)d, _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range)));
+    }
+#endif
+
+    for (; end - s >= 3; s += 3U, d += 4U) {
+        const unsigned long v = ((unsigned long)s[0] << 16U) | ((unsigned long)s[1] << 8U) | s[2];
+
+        d[0] = ext_base64[(v >> 18U) & 0x3FU];
+        d[1] = ext_base64[(v >> 12U) & 0x3FU];
+        d[2] = ext_base64[(v >> 6U) & 0x3FU];
+        d[3] = ext_base64[v & 0x3FU];
+    }
+
+    if (s < end) {
+        const unsigned long v = ((unsigned long)s[0] << 16U) | ((end - s == 2) ? (unsigned long)s[1] << 8U : 0U);
+
+        d[0] = ext_base64[(v >> 18U) & 0x3FU];
+        d[1] = ext_base64[(v >> 12U) & 0x3FU];
+        d[2] = (end - s == 2) ? ext_base64[(v >> 6U) & 0x3FU] : '=';
+        d[3] = '=';
+        d += 4U;
+    }
+
+    *d = '\0';
+    return (nva_Size)(d - dst);
+}
@@ -0,0 +1,700 @@
+/**
+ * @file csv.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 按列模式写出 CSV/TSV 行
+ */
+
+#include "nva/ext/args.h"
+#include "nva/ext/csv.h"
+#include "nva/ext/string.h"
+
+#include "simd.h"
+
+/* 列的转换方式 */
+#define EXT_CSV_SIGNED        0U /* signed char、short 与 int，以 nva_itoa 转换 */
+#define EXT_CSV_UNSIGNED      1U /* unsigned char、unsigned short 与 unsigned int，以 nva_uitoa 转换 */
+#define EXT_CSV_SIGNED_LONG   2U /* long 与 long long，逐位转换 */
+#define EXT_CSV_UNSIGNED_LONG 3U /* unsigned long 与 unsigned long long，逐位转换 */
+#define EXT_CSV_FLOAT         4U /* float 与 double，以 nva_fptoa 转换 */
+#define EXT_CSV_CHAR          5U
+#define EXT_CSV_STR           6U
+#define EXT_CSV_STRN          7U
+#define EXT_CSV_FORMAT        8U /* 逐字段调用 nva_format */
+
+/* 规格中宽度与精度的上限，保证逐字段格式化的结果放得下暂存区 */
+#define EXT_CSV_MAX_NUMBER    255U
+
+/* {:f} 输出 double 时最长的结果：309 位整数部分、小数点、最多 255 位小数、符号与 '\0'，另外在开头留出正号的位置 */
+#define EXT_CSV_SCRATCH_SIZE  (309U + 1U + 255U + 2U + 1U)
+
+/* extCsvRow 的结果 */
+#define EXT_CSV_OK           0
+#define EXT_CSV_FULL         1
+#define EXT_CSV_BAD          2
+
+/* 初始化时试格式化使用的零值 */
+typedef union {
+    unsigned long long ull;
+    double d;
+    const void* p;
+} ExtCsvZero;
+
+static int extCsvIsSpecial(const char separator, const char c)
+{
+    return c == separator || c == '"' || c == '\n' || c == '\r';
+}
+
+/* 字段是否需要引号：支持 SSE2 时每次检查 16 字节 */
+static int extCsvNeedsQuote(const char separator, const char* s, nva_Size len)
+{
+#ifdef NVA_EXT_SSE2
+    const __m128i sep = _mm_set1_epi8(separator);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+
+    while (len >= 16U) {
+        const __m128i x = _mm_loadu_si128((const __m128i*)s);
+        const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, sep), _mm_cmpeq_epi8(x, quote)),
+                                             _mm_or_si128(_mm_cmpeq_epi8(x, lf), _mm_cmpeq_epi8(x, cr)));
+
+        if (_mm_movemask_epi8(special) != 0) {
+            return 1;
+        }
+        s += 16U;
+        len -= 16U;
+    }
+#endif
+
+    for (; len > 0U; ++s, --len) {
+        if (extCsvIsSpecial(separator, *s)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* 写入 n 个填充字符，加引号的字段中 '"' 需要加倍 */
+static char* extCsvFill(char* d, const char fill, nva_Size n, const int quoted)
+{
+    if (quoted && fill == '"') {
+        n *= 2U;
+    }
+    nva_memset(d, fill, n);
+
+    return d + n;
+}
+
+/*
+ * 把 text 写入缓冲区末尾，左右分别补 left 与 right 个 fill；需要时整个字段加引号。
+ * 空间不足时返回 EXT_CSV_FULL，不修改 writer->len
+ */
+static int extCsvPut(nva_CsvWriter* const writer,
+                     const char* const text,
+                     const nva_Size len,
+                     const char fill,
+                     const nva_Size left,
+                     const nva_Size right)
+{
+    const int quoted = extCsvNeedsQuote(writer->separator, text, len) ||
+                       (left + right > 0U && extCsvIsSpecial(writer->separator, fill));
+    nva_Size need = left + len + right;
+    char* d;
+
+    if (quoted) {
+        const char* s = text;
+        const char* const end = text + len;
+
+        need += 2U + ((fill == '"') ? left + right : 0U);
+        while ((s = (const char*)nva_memchr(s, '"', (nva_Size)(end - s))) != NULL) {
+            ++need;
+            ++s;
+        }
+    }
+
+    if (need > writer->cap - writer->len) {
+        return EXT_CSV_FULL;
+    }
+
+    d = writer->buf + writer->len;
+
+    if (!quoted) {
+        d = extCsvFill(d, fill, left, 0);
+        nva_memcpy(d, text, len);
+        d = extCsvFill(d + len, fill, right, 0);
+    }
+    else {
+        const char* s = text;
+        const char* const end = text + len;
+        const char* q;
+
+        *d++ = '"';
+        d = extCsvFill(d, fill, left, 1);
+        /* 逐段拷贝，每个引号之后再补一个引号 */
+        while ((q = (const char*)nva_memchr(s, '"', (nva_Size)(end - s))) != NULL) {
+            nva_memcpy(d, s, (nva_Size)(q - s) + 1U);
+            d += (q - s) + 1;
+            *d++ = '"';
+            s = q + 1;
+        }
+        nva_memcpy(d, s, (nva_Size)(end - s));
+        d += end - s;
+        d = extCsvFill(d, fill, right, 1);
+        *d++ = '"';
+    }
+
+    writer->len = (nva_Size)(d - writer->buf);
+
+    return EXT_CSV_OK;
+}
+
+static int extCsvPutRaw(nva_CsvWriter* const writer, const char* const text, const nva_Size len)
+{
+    if (len > writer->cap - writer->len) {
+        return EXT_CSV_FULL;
+    }
+
+    nva_memcpy(writer->buf + writer->len, text, len);
+    writer->len += len;
+
+    return EXT_CSV_OK;
+}
+
+/* 按 fill/align/width 补齐直接转换的字段 */
+static int extCsvPutAligned(nva_CsvWriter* const writer,
+                            const nva_CsvField* const field,
+                            const char* const text,
+                            const nva_Size len)
+{
+    const nva_Size pad = (field->width > len) ? field->width - len : 0U;
+    const nva_Size left = (field->align == '>') ? pad : ((field->align == '^') ? pad / 2U : 0U);
+
+    return extCsvPut(writer, text, len, field->fill, left, pad - left);
+}
+
+/* 写出数字字段 text：按 sign 补上正号，补零时 0 写在符号之后，否则按 fill/align 对齐。text 之前至少留有一个字节 */
+static int extCsvPutNumber(nva_CsvWriter* const writer, const nva_CsvField* const field, char* text, nva_Size len)
+{
+    nva_Size lead;
+
+    if (field->sign != '-' && text[0] != '-') {
+        *--text = field->sign;
+        ++len;
+    }
+    if (!field->zero || field->width <= len) {
+        return extCsvPutAligned(writer, field, text, len);
+    }
+
+    /* 符号留在最前，其后的字符右移，空出的位置补 0 */
+    lead = (text[0] == '-' || text[0] == '+' || text[0] == ' ') ? 1U : 0U;
+    nva_memmove(text + lead + (field->width - len), text + lead, len - lead);
+    nva_memset(text + lead, '0', field->width - len);
+
+    return extCsvPut(writer, text, field->width, ' ', 0U, 0U);
+}
+
+/* 按列的类型读出有符号整数 */
+static long long extCsvReadSigned(const nva_TypeId type, const void* const value)
+{
+    switch (type) {
+    case NVA_TYPEID_SCHAR:
+        return *(const signed char*)value;
+    case NVA_TYPEID_SSHORT:
+        return *(const short*)value;
+    case NVA_TYPEID_SLONG:
+        return *(const long*)value;
+    case NVA_TYPEID_SLLONG:
+        return *(const long long*)value;
+    default:
+        return *(const int*)value;
+    }
+}
+
+/* 按列的类型读出无符号整数 */
+static unsigned long long extCsvReadUnsigned(const nva_TypeId type, const void* const value)
+{
+    switch (type) {
+    case NVA_TYPEID_UCHAR:
+        return *(const unsigned char*)value;
+    case NVA_TYPEID_USHORT:
+        return *(const unsigned short*)value;
+    case NVA_TYPEID_ULONG:
+        return *(const unsigned long*)value;
+    case NVA_TYPEID_ULLONG:
+        return *(const unsigned long long*)value;
+    default:
+        return *(const unsigned int*)value;
+    }
+}
+
+/* long 与 long long 没有对应的 nva_itoa：按 attr 的进制逐位转换 magnitude，negative 非 0 时加负号，返回写入的长度 */
+static nva_Size extCsvLongToA(const unsigned long long magnitude,
+                              const int negative,
+                              char* const dst,
+                              const nva_NumToStringAttr* const attr)
+{
+    const char* const digits = attr->upper_case ? "0123456789ABCDEF" : "0123456789abcdef";
+    char buf[sizeof(unsigned long long) * 8U + 1U];
+    char* p = buf + sizeof(buf);
+    unsigned long long rest = magnitude;
+
+    do {
+        *--p = digits[rest % attr->base];
+        rest /= attr->base;
+    } while (rest != 0U);
+    if (negative) {
+        *--p = '-';
+    }
+
+    nva_memcpy(dst, p, (nva_Size)(buf + sizeof(buf) - p));
+
+    return (nva_Size)(buf + sizeof(buf) - p);
+}
+
+/* 以 field->format 格式化一个参数，写入 scratch，返回写入的长度；失败时返回 0 并置 *code */
+static nva_Size extCsvFormat(const nva_CsvField* const field,
+                             const nva_TypeId type,
+                             const void* const value,
+                             char* const scratch,
+                             nva_ErrorCode* const code)
+{
+    *code = nva_format(scratch, field->format, nva_pushArgs(&type, &value, 1U, NVA_START));
+
+    return (*code == NVA_SUCCESS) ? nva_strlen(scratch) : 0U;
+}
+
+static int extCsvPutValue(nva_CsvWriter* const writer,
+                          const nva_CsvField* const field,
+                          const nva_TypeId type,
+                          const void* const value,
+                          char* const scratch)
+{
+    char* const text = scratch + 1; /* 留出正号的位置 */
+    unsigned int width = 0U;
+    nva_ErrorCode code;
+    nva_Size len;
+
+    if (!value) {
+        return EXT_CSV_BAD;
+    }
+
+    switch (field->kind) {
+    case EXT_CSV_SIGNED:
+        (void)nva_itoa((int)extCsvReadSigned(type, value), text, &field->attr.num, &width);
+        return extCsvPutNumber(writer, field, text, width);
+    case EXT_CSV_UNSIGNED:
+        (void)nva_uitoa((unsigned int)extCsvReadUnsigned(type, value), text, &field->attr.num, &width);
+        return extCsvPutNumber(writer, field, text, width);
+    case EXT_CSV_SIGNED_LONG: {
+        const long long number = extCsvReadSigned(type, value);
+        const unsigned long long magnitude = (unsigned long long)number;
+
+        /* 负数的绝对值以无符号取反得到，LLONG_MIN 同样正确 */
+        len = extCsvLongToA((number < 0) ? 0U - magnitude : magnitude, number < 0, text, &field->attr.num);
+        return extCsvPutNumber(writer, field, text, len);
+    }
+    case EXT_CSV_UNSIGNED_LONG:
+        len = extCsvLongToA(extCsvReadUnsigned(type, value), 0, text, &field->attr.num);
+        return extCsvPutNumber(writer, field, text, len);
+    case EXT_CSV_FLOAT: {
+        const double number = (type == NVA_TYPEID_FLOAT) ? (double)*(const float*)value : *(const double*)value;
+
+        return extCsvPutNumber(writer, field, text, nva_fptoa(number, text, &field->attr.fp));
+    }
+    case EXT_CSV_CHAR:
+        return extCsvPutAligned(writer, field, (const char*)value, 1U);
+    case EXT_CSV_STR:
+        if (!*(const char* const*)value) {
+            return EXT_CSV_BAD;
+        }
+        return extCsvPutAligned(writer, field, *(const char* const*)value, nva_strlen(*(const char* const*)value));
+#ifdef NVA_EXT_WITH_STRN
+    case EXT_CSV_STRN:
+        return extCsvPutAligned(writer, field, ((const nva_StrView*)value)->ptr, ((const nva_StrView*)value)->len);
+#endif
+    default:
+        len = extCsvFormat(field, type, value, scratch, &code);
+        if (code != NVA_SUCCESS) {
+            return EXT_CSV_BAD;
+        }
+        return extCsvPut(writer, scratch, len, ' ', 0U, 0U);
+    }
+}
+
+/* 在缓冲区末尾写出一行，values 为 NULL 时写出表头 */
+static int extCsvRow(nva_CsvWriter* const writer, const void* const* const values)
+{
+    char scratch[EXT_CSV_SCRATCH_SIZE];
+    nva_Size i;
+    int result;
+
+    for (i = 0U; i < writer->count; ++i) {
+        const nva_CsvColumn* const column = &writer->columns[i];
+
+        if (i > 0U && extCsvPutRaw(writer, &writer->separator, 1U) != EXT_CSV_OK) {
+            return EXT_CSV_FULL;
+        }
+
+        if (values) {
+            result = extCsvPutValue(writer, &writer->fields[i], column->type, values[i], scratch);
+        }
+        else {
+            result = extCsvPut(writer, column->name, nva_strlen(column->name), ' ', 0U, 0U);
+        }
+        if (result != EXT_CSV_OK) {
+            return result;
+        }
+    }
+
+    return extCsvPutRaw(writer, "\r\n", 2U);
+}
+
+/* 写出一行；放不下时先刷出之前的内容再重写，仍然放不下时失败。失败时不保留该行的任何部分 */
+static nva_ErrorCode extCsvWrite(nva_CsvWriter* const writer, const void* const* const values)
+{
+    nva_Size start = writer->len;
+    int result = extCsvRow(writer, values);
+
+    if (result == EXT_CSV_FULL && start > 0U) {
+        nva_ErrorCode code;
+
+        writer->len = start;
+        code = nva_csvFlush(writer);
+        if (code != NVA_SUCCESS) {
+            return code;
+        }
+        start = 0U;
+        result = extCsvRow(writer, values);
+    }
+
+    if (result != EXT_CSV_OK) {
+        writer->len = start;
+        return NVA_FAIL;
+    }
+
+    return NVA_SUCCESS;
+}
+
+/* 解析一串十进制数字并累加到 *number，超过 EXT_CSV_MAX_NUMBER 时返回 0 */
+static int extCsvDecodeNumber(const char** const spec, nva_Size* const number)
+{
+    const char* p = *spec;
+
+    while (*p >= '0' && *p <= '9') {
+        *number = *number * 10U + (nva_Size)(*p++ - '0');
+        if (*number > EXT_CSV_MAX_NUMBER) {
+            return 0;
+        }
+    }
+    *spec = p;
+
+    return 1;
+}
+
+/*
+ * 解析 [[fill]align][sign][#][0][width][.precision][type]，能直接转换时写入 field 并返回 1。
+ * 整数列支持符号（无符号整数与非十进制除外）与补零，浮点数列还支持 f/F/g/G、精度与 '#'；
+ * 补零与显式对齐同时出现、整数的 '#' 与精度、浮点数的 e/E/% 与省略类型字符等其余规格交给 nva_format
+ */
+static int extCsvDecodeDirect(nva_CsvField* const field, const char* spec, const nva_TypeId type)
+{
+    nva_Size precision = 6U;
+    int has_precision = 0;
+    int has_align = 0;
+    int alternate = 0;
+
+    field->sign = '-';
+    field->zero = 0U;
+    field->fill = ' ';
+    field->align = '>';
+    field->width = 0U;
+    field->attr.num.base = 10U;
+    field->attr.num.upper_case = NVA_FALSE;
+
+    switch (type) {
+    case NVA_TYPEID_SCHAR:
+    case NVA_TYPEID_SSHORT:
+    case NVA_TYPEID_SINT:
+        field->kind = EXT_CSV_SIGNED;
+        break;
+    case NVA_TYPEID_UCHAR:
+    case NVA_TYPEID_USHORT:
+    case NVA_TYPEID_UINT:
+        field->kind = EXT_CSV_UNSIGNED;
+        break;
+    case NVA_TYPEID_SLONG:
+    case NVA_TYPEID_SLLONG:
+        field->kind = EXT_CSV_SIGNED_LONG;
+        break;
+    case NVA_TYPEID_ULONG:
+    case NVA_TYPEID_ULLONG:
+        field->kind = EXT_CSV_UNSIGNED_LONG;
+        break;
+    case NVA_TYPEID_FLOAT:
+    case NVA_TYPEID_DOUBLE:
+        field->kind = EXT_CSV_FLOAT;
+        break;
+    case NVA_TYPEID_CHAR:
+        field->kind = EXT_CSV_CHAR;
+        field->align = '<';
+        break;
+    case NVA_TYPEID_STR:
+        field->kind = EXT_CSV_STR;
+        field->align = '<';
+        break;
+#ifdef NVA_EXT_WITH_STRN
+    case NVA_TYPEID_STRN:
+        field->kind = EXT_CSV_STRN;
+        field->align = '<';
+        break;
+#endif
+    default:
+        return 0;
+    }
+
+    if (spec[0] != '\0' && (spec[1] == '<' || spec[1] == '>' || spec[1] == '^')) {
+        field->fill = spec[0];
+        field->align = spec[1];
+        has_align = 1;
+        spec += 2;
+    }
+    else if (spec[0] == '<' || spec[0] == '>' || spec[0] == '^') {
+        field->align = spec[0];
+        has_align = 1;
+        spec += 1;
+    }
+
+    if (*spec == '+' || *spec == '-' || *spec == ' ') {
+        field->sign = *spec++;
+    }
+    if (*spec == '#') {
+        alternate = 1;
+        ++spec;
+    }
+    if (*spec == '0') {
+        field->zero = 1U;
+        ++spec;
+    }
+    if (!extCsvDecodeNumber(&spec, &field->width)) {
+        return 0;
+    }
+    if (*spec == '.') {
+        ++spec;
+        precision = 0U;
+        has_precision = 1;
+        if (*spec < '0' || *spec > '9' || !extCsvDecodeNumber(&spec, &precision)) {
+            return 0;
+        }
+    }
+    if (spec[0] != '\0' && spec[1] != '\0') {
+        return 0;
+    }
+
+    /* 补零与显式对齐同时出现时交给库处理；'#' 与精度只用于浮点数 */
+    if ((field->zero && has_align) || ((alternate || has_precision) && field->kind != EXT_CSV_FLOAT)) {
+        return 0;
+    }
+
+    switch (field->kind) {
+    case EXT_CSV_SIGNED:
+    case EXT_CSV_SIGNED_LONG:
+        return spec[0] == '\0' || spec[0] == 'd';
+    case EXT_CSV_UNSIGNED:
+    case EXT_CSV_UNSIGNED_LONG:
+        if (field->sign != '-') {
+            return 0;
+        }
+        switch (spec[0]) {
+        case '\0':
+        case 'd':
+            return 1;
+        case 'x':
+            field->attr.num.base = 16U;
+            return 1;
+        case 'X':
+            field->attr.num.base = 16U;
+            field->attr.num.upper_case = NVA_TRUE;
+            return 1;
+        case 'o':
+            field->attr.num.base = 8U;
+            return 1;
+        case 'b':
+            field->attr.num.base = 2U;
+            return 1;
+        default:
+            return 0;
+        }
+    case EXT_CSV_FLOAT:
+        field->attr.fp.base = 10U;
+        field->attr.fp.precision = (unsigned char)precision;
+        field->attr.fp.flag.keep_decimal_point = alternate ? 1U : 0U;
+        field->attr.fp.flag.upper_case = (spec[0] == 'F' || spec[0] == 'G') ? 1U : 0U;
+        switch (spec[0]) {
+        case 'f':
+        case 'F':
+            field->attr.fp.flag.type = NVA_FP_TO_STR_TYPE_F;
+            return 1;
+        case 'g':
+        case 'G':
+            field->attr.fp.flag.type = NVA_FP_TO_STR_TYPE_G;
+            return 1;
+        default:
+            return 0;
+        }
+    default:
+        /* 字符与字符串不接受符号与补零 */
+        if (field->sign != '-' || field->zero) {
+            return 0;
+        }
+        return spec[0] == '\0' || spec[0] == ((field->kind == EXT_CSV_CHAR) ? 'c' : 's');
+    }
+}
+
+/* 规格末尾的类型字符是否适用于列的类型 */
+static int extCsvTypeCharAllowed(const nva_TypeId type, const char c)
+{
+    const char* allowed;
+
+    switch (type) {
+    case NVA_TYPEID_FLOAT:
+    case NVA_TYPEID_DOUBLE:
+        allowed = "eEfFgG%";
+        break;
+    case NVA_TYPEID_PTR:
+        allowed = "pxX";
+        break;
+    default:
+        allowed = "bBcdoxX";
+        break;
+    }
+
+    return nva_memchr(allowed, c, nva_strlen(allowed)) != NULL;
+}
+
+/* 生成 "{:spec}" 并以零值试格式化一次，规格无效时返回 NVA_FAIL */
+static nva_ErrorCode extCsvCompileFormat(nva_CsvField* const field, const char* const spec, const nva_TypeId type)
+{
+    static const ExtCsvZero zero = {0U};
+    char scratch[EXT_CSV_SCRATCH_SIZE];
+    nva_ErrorCode code;
+    nva_Size number = 0U;
+    nva_Size i;
+
+    /* 字符串的长度没有上限，放不进暂存区，只支持直接转换的规格 */
+    if (type == NVA_TYPEID_STR) {
+        return NVA_FAIL;
+    }
+#ifdef NVA_EXT_WITH_STRN
+    if (type == NVA_TYPEID_STRN) {
+        return NVA_FAIL;
+    }
+#endif
+
+    for (i = 0U; spec[i] != '\0'; ++i) {
+        /* 列的规格中不允许位置参数与嵌套的花括号 */
+        if (spec[i] == ':' || spec[i] == '{' || spec[i] == '}') {
+            return NVA_FAIL;
+        }
+        number = (spec[i] >= '0' && spec[i] <= '9') ? number * 10U + (nva_Size)(spec[i] - '0') : 0U;
+        if (number > EXT_CSV_MAX_NUMBER) {
+            return NVA_FAIL;
+        }
+    }
+    if (i + 4U > NVA_CSV_FORMAT_SIZE) {
+        return NVA_FAIL;
+    }
+    /* 以字母结尾时视为类型字符，先于 nva_format 检查与列的类型是否相符 */
+    if (i > 0U && (((spec[i - 1U] | 0x20) >= 'a' && (spec[i - 1U] | 0x20) <= 'z') || spec[i - 1U] == '%') &&
+        !extCsvTypeCharAllowed(type, spec[i - 1U])) {
+        return NVA_FAIL;
+    }
+
+    field->kind = EXT_CSV_FORMAT;
+    field->format[0] = '{';
+    field->format[1] = ':';
+    nva_memcpy(field->format + 2U, spec, i);
+    field->format[i + 2U] = '}';
+    field->format[i + 3U] = '\0';
+
+    (void)extCsvFormat(field, type, &zero, scratch, &code);
+
+    return (code == NVA_SUCCESS) ? NVA_SUCCESS : NVA_FAIL;
+}
+
+nva_ErrorCode nva_csvWriterInit(nva_CsvWriter* const writer,
+                                const nva_CsvColumn* const columns,
+                                const nva_Size count,
+                                const char separator,
+                                char* const buf,
+                                const nva_Size cap,
+                                const nva_CsvFlushFn flush,
+                                void* const ctx)
+{
+    nva_Size i;
+
+    if (!writer || !columns || count == 0U || count > NVA_CSV_MAX_COLUMNS || !buf || cap == 0U || !flush) {
+        return NVA_PARAM_ERROR;
+    }
+
+    for (i = 0U; i < count; ++i) {
+        const char* const spec = columns[i].spec ? columns[i].spec : "";
+
+        if (!columns[i].name) {
+            return NVA_PARAM_ERROR;
+        }
+        if (!extCsvDecodeDirect(&writer->fields[i], spec, columns[i].type) &&
+            extCsvCompileFormat(&writer->fields[i], spec, columns[i].type) != NVA_SUCCESS) {
+            return NVA_FAIL;
+        }
+    }
+
+    writer->columns = columns;
+    writer->count = count;
+    writer->separator = separator;
+    writer->buf = buf;
+    writer->len = 0U;
+    writer->cap = cap;
+    writer->flush = flush;
+    writer->ctx = ctx;
+
+    return NVA_SUCCESS;
+}
+
+nva_ErrorCode nva_csvWriteHeader(nva_CsvWriter* const writer)
+{
+    if (!writer) {
+        return NVA_PARAM_ERROR;
+    }
+
+    return extCsvWrite(writer, NULL);
+}
+
+nva_ErrorCode nva_csvWriteRow(nva_CsvWriter* const writer, const void* const* const values)
+{
+    if (!writer || !values) {
+        return NVA_PARAM_ERROR;
+    }
+
+    return extCsvWrite(writer, values);
+}
+
+nva_ErrorCode nva_csvFlush(nva_CsvWriter* const writer)
+{
+    nva_ErrorCode code;
+
+    if (!writer) {
+        return NVA_PARAM_ERROR;
+    }
+    if (writer->len == 0U) {
+        return NVA_SUCCESS;
+    }
+
+    code = writer->flush(writer->ctx, writer->buf, writer->len);
+    if (code == NVA_SUCCESS) {
+        writer->len = 0U;
+    }
+
+    return code;
+}
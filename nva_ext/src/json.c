@@ -0,0 +1,330 @@
+/**
+ * @file json.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief JSON 字符串转义与 JSON 行输出
+ */
+
+#include "nva/ext/args.h"
+#include "nva/ext/json.h"
+
+#include "simd.h"
+
+static const char ext_json_hex[] = "0123456789abcdef";
+
+/* 写出一个需要转义的字节，返回写入的长度 */
+static nva_Size extJsonEscapeByte(char* const dst, const unsigned char c)
+{
+    dst[0] = '\\';
+
+    switch (c) {
+    case '"':
+    case '\\':
+        dst[1] = (char)c;
+        return 2U;
+    case '\b':
+        dst[1] = 'b';
+        return 2U;
+    case '\f':
+        dst[1] = 'f';
+        return 2U;
+    case '\n':
+        dst[1] = 'n';
+        return 2U;
+    case '\r':
+        dst[1] = 'r';
+        return 2U;
+    case '\t':
+        dst[1] = 't';
+        return 2U;
+    default:
+        dst[1] = 'u';
+        dst[2] = '0';
+        dst[3] = '0';
+        dst[4] = ext_json_hex[c >> 4U];
+        dst[5] = ext_json_hex[c & 0x0FU];
+        return 6U;
+    }
+}
+
+static int extJsonNeedsEscape(const unsigned char c)
+{
+    return c == '"' || c == '\\' || c < 0x20U;
+}
+
+nva_Size nva_jsonEscape(char* const dst, const char* const src, const nva_Size len)
+{
+    const unsigned char* s = (const unsigned char*)src;
+    const unsigned char* const end = s + len;
+    char* d = dst;
+
+#ifdef NVA_EXT_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+
+    while (end - s >= 16) {
+        const __m128i x = _mm_loadu_si128((const __m128i*)s);
+        /* max(x, 0x1F) == 0x1F 即 x <= 0x1F */
+        const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, quote), _mm_cmpeq_epi8(x, backslash)),
+                                             _mm_cmpeq_epi8(_mm_max_epu8(x, control), control));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(special);
+
+        if (mask == 0U) {
+            nva_memcpy(d, s, 16U);
+            d += 16U;
+            s += 16U;
+            continue;
+        }
+
+        /* 逐个处理块内需要转义的字节，之间的字节整段拷贝 */
+        {
+            unsigned int pos = 0U;
+
+            while (mask != 0U) {
+                const unsigned int i = extLowestBit(mask);
+
+                nva_memcpy(d, s + pos, i - pos);
+                d += i - pos;
+                d += extJsonEscapeByte(d, s[i]);
+                pos = i + 1U;
+                mask &= mask - 1U;
+            }
+            nva_memcpy(d, s + pos, 16U - pos);
+            d += 16U - pos;
+            s += 16U;
+        }
+    }
+#endif
+
+    while (s < end) {
+        const unsigned char* run = s;
+
+        while (s < end && !extJsonNeedsEscape(*s)) {
+            ++s;
+        }
+        nva_memcpy(d, run, (nva_Size)(s - run));
+        d += s - run;
+
+        if (s < end) {
+            d += extJsonEscapeByte(d, *s);
+            ++s;
+        }
+    }
+
+    *d = '\0';
+    return (nva_Size)(d - dst);
+}
+
+/* 一个字节转义后的长度 */
+static nva_Size extJsonEscapedByteLength(const unsigned char c)
+{
+    switch (c) {
+    case '"':
+    case '\\':
+    case '\b':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+        return 2U;
+    default:
+        return (c < 0x20U) ? 6U : 1U;
+    }
+}
+
+/* 转义后的长度，用于剩余空间不足 6 * len 时的精确检查 */
+static nva_Size extJsonEscapedLength(const char* const src, const nva_Size len)
+{
+    const unsigned char* const s = (const unsigned char*)src;
+    nva_Size total = 0U;
+    nva_Size i;
+
+    for (i = 0U; i < len; ++i) {
+        total += extJsonEscapedByteLength(s[i]);
+    }
+
+    return total;
+}
+
+/* 浮点数是否有限：NaN 与自身不等，无穷大减去自身得到 NaN */
+static int extIsFinite(const double value)
+{
+    const double diff = value - value;
+
+    return diff == diff;
+}
+
+/* 以 {} 格式化一个参数时最长的结果：double 以 {:f} 输出时的 309 位整数部分、小数点、最多 255 位小数、符号与 '\0' */
+#define EXT_JSON_VALUE_SIZE (309U + 1U + 255U + 2U)
+
+/* 剩余空间放不下最长结果时，格式化结果先写在这里。nva_format 的参数栈本身就是全局的，这里同样不可重入 */
+static char ext_json_scratch[EXT_JSON_VALUE_SIZE];
+
+/* 输出位置与剩余空间，room 含结尾的 '\0' */
+typedef struct {
+    char* d;
+    nva_Size room;
+} ExtJsonOut;
+
+/* 剩余空间足够时写入 [src, src + len) */
+static nva_ErrorCode extJsonPut(ExtJsonOut* const out, const char* const src, const nva_Size len)
+{
+    if (len >= out->room) {
+        return NVA_FAIL;
+    }
+
+    nva_memcpy(out->d, src, len);
+    out->d += len;
+    out->room -= len;
+
+    return NVA_SUCCESS;
+}
+
+/* 写入带引号的转义字符串。剩余空间放得下最坏的 6 * len 时直接转义，否则先算出转义后的长度再检查 */
+static nva_ErrorCode extJsonPutString(ExtJsonOut* const out, const char* const src, const nva_Size len)
+{
+    nva_Size written;
+
+    if (out->room < 3U) {
+        return NVA_FAIL;
+    }
+    if (len > (out->room - 3U) / 6U && extJsonEscapedLength(src, len) > out->room - 3U) {
+        return NVA_FAIL;
+    }
+
+    *out->d = '"';
+    written = nva_jsonEscape(out->d + 1, src, len);
+    out->d[written + 1U] = '"';
+    out->d += written + 2U;
+    out->room -= written + 2U;
+
+    return NVA_SUCCESS;
+}
+
+/* 以 {} 格式化一个参数。剩余空间放得下最长结果时直接写在输出位置，否则写入暂存区后按剩余空间检查并复制 */
+static nva_ErrorCode extJsonPutValue(ExtJsonOut* const out, const nva_TypeId type, const void* const value)
+{
+    char* const dst = (out->room >= EXT_JSON_VALUE_SIZE) ? out->d : ext_json_scratch;
+    nva_Size len;
+
+    if (nva_format(dst, "{}", nva_pushArgs(&type, &value, 1U, NVA_START)) != NVA_SUCCESS) {
+        return NVA_FAIL;
+    }
+
+    len = nva_strlen(dst);
+    if (dst != out->d) {
+        return extJsonPut(out, dst, len);
+    }
+
+    out->d += len;
+    out->room -= len;
+
+    return NVA_SUCCESS;
+}
+
+/* 写出整个对象，失败时由调用者清空 dst */
+static nva_ErrorCode extJsonObject(ExtJsonOut* const out,
+                                   const char* const* const keys,
+                                   const nva_TypeId* const types,
+                                   const void* const* const values,
+                                   const nva_Size n)
+{
+    nva_ErrorCode code;
+    nva_Size i;
+
+    if (extJsonPut(out, "{", 1U) != NVA_SUCCESS) {
+        return NVA_FAIL;
+    }
+
+    for (i = 0U; i < n; ++i) {
+        const void* const value = values[i];
+
+        if (!keys[i] || !value) {
+            return NVA_PARAM_ERROR;
+        }
+
+        if (i > 0U && extJsonPut(out, ",", 1U) != NVA_SUCCESS) {
+            return NVA_FAIL;
+        }
+        if (extJsonPutString(out, keys[i], nva_strlen(keys[i])) != NVA_SUCCESS
+            || extJsonPut(out, ":", 1U) != NVA_SUCCESS) {
+            return NVA_FAIL;
+        }
+
+        switch (types[i]) {
+        case NVA_TYPEID_STR:
+            code = extJsonPutString(out, *(const char* const*)value, nva_strlen(*(const char* const*)value));
+            break;
+#ifdef NVA_EXT_WITH_STRN
+        case NVA_TYPEID_STRN:
+            code = extJsonPutString(out, ((const nva_StrView*)value)->ptr, ((const nva_StrView*)value)->len);
+            break;
+#endif
+        case NVA_TYPEID_CHAR:
+            code = extJsonPutString(out, (const char*)value, 1U);
+            break;
+        case NVA_TYPEID_PTR:
+            code = extJsonPut(out, "\"", 1U);
+            if (code == NVA_SUCCESS) {
+                code = extJsonPutValue(out, types[i], value);
+            }
+            if (code == NVA_SUCCESS) {
+                code = extJsonPut(out, "\"", 1U);
+            }
+            break;
+        case NVA_TYPEID_FLOAT:
+        case NVA_TYPEID_DOUBLE: {
+            const double number = (types[i] == NVA_TYPEID_FLOAT) ? (double)*(const float*)value : *(const double*)value;
+
+            code = extIsFinite(number) ? extJsonPutValue(out, types[i], value) : extJsonPut(out, "null", 4U);
+            break;
+        }
+        default:
+            code = extJsonPutValue(out, types[i], value);
+            break;
+        }
+
+        if (code != NVA_SUCCESS) {
+            return NVA_FAIL;
+        }
+    }
+
+    if (extJsonPut(out, "}", 1U) != NVA_SUCCESS) {
+        return NVA_FAIL;
+    }
+    *out->d = '\0';
+
+    return NVA_SUCCESS;
+}
+
+nva_ErrorCode nva_formatJsonArgs(char* const dst,
+                                 const nva_Size cap,
+                                 const char* const* const keys,
+                                 const nva_TypeId* const types,
+                                 const void* const* const values,
+                                 const nva_Size n)
+{
+    ExtJsonOut out;
+    nva_ErrorCode code;
+
+    if (!dst || cap == 0U) {
+        return NVA_PARAM_ERROR;
+    }
+
+    out.d = dst;
+    out.room = cap;
+
+    if (n > 0U && (!keys || !types || !values)) {
+        code = NVA_PARAM_ERROR;
+    }
+    else {
+        code = extJsonObject(&out, keys, types, values, n);
+    }
+
+    if (code != NVA_SUCCESS) {
+        *dst = '\0';
+    }
+
+    return code;
+}
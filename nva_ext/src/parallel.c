@@ -0,0 +1,256 @@
+/**
+ * @file parallel.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 多线程的大尺寸拷贝与移动
+ *
+ * 没有 pthread 的平台上退化为 nva_memcpy/nva_memmove。
+ */
+
+#include "nva/ext/string.h"
+
+#ifdef NVA_EXT_USE_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* 相邻两块的分界对齐到目的地址的缓存行边界，两个线程不会写同一缓存行 */
+#define EXT_CACHE_LINE 64U
+
+typedef struct {
+    unsigned char* dst;
+    const unsigned char* src;
+    nva_Size n;
+} ExtCopyTask;
+
+#ifdef NVA_EXT_USE_PTHREADS
+
+/* 一次切分得到的全部块：next 之前的块已被领取，remaining 为尚未完成的块数 */
+typedef struct ExtCopyBatch {
+    ExtCopyTask* tasks;
+    unsigned int count;
+    unsigned int next;
+    unsigned int remaining;
+    struct ExtCopyBatch* link;
+} ExtCopyBatch;
+
+/* 常驻的工作线程池，第一次切分时创建。各调用者的批次按提交顺序排队，批次在栈上，完成前不会返回 */
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work; /* 队列中有待领取的块 */
+    pthread_cond_t done; /* 有批次的最后一块完成 */
+    ExtCopyBatch* head;
+    ExtCopyBatch* tail;
+    unsigned int cpus; /* 在线的处理器数，只在创建线程池时读取一次 */
+} ext_pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 1U};
+
+static pthread_once_t ext_pool_once = PTHREAD_ONCE_INIT;
+
+/* 从 batch 领取下一块，领完时把 batch 移出队列。调用时持有 ext_pool.lock */
+static const ExtCopyTask* extPoolClaim(ExtCopyBatch* const batch)
+{
+    const ExtCopyTask* const task = &batch->tasks[batch->next++];
+
+    if (batch->next == batch->count) {
+        ExtCopyBatch** link = &ext_pool.head;
+        ExtCopyBatch* prev = NULL;
+
+        while (*link != batch) {
+            prev = *link;
+            link = &prev->link;
+        }
+        *link = batch->link;
+        if (ext_pool.tail == batch) {
+            ext_pool.tail = prev;
+        }
+    }
+
+    return task;
+}
+
+/* 完成 batch 中的一块。调用时持有 ext_pool.lock */
+static void extPoolFinish(ExtCopyBatch* const batch)
+{
+    if (--batch->remaining == 0U) {
+        pthread_cond_broadcast(&ext_pool.done);
+    }
+}
+
+static void* extPoolWorker(void* const arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&ext_pool.lock);
+    for (;;) {
+        ExtCopyBatch* batch;
+        const ExtCopyTask* task;
+
+        while (!ext_pool.head) {
+            pthread_cond_wait(&ext_pool.work, &ext_pool.lock);
+        }
+        batch = ext_pool.head;
+        task = extPoolClaim(batch);
+
+        pthread_mutex_unlock(&ext_pool.lock);
+        nva_memcpy(task->dst, task->src, task->n);
+        pthread_mutex_lock(&ext_pool.lock);
+
+        extPoolFinish(batch);
+    }
+
+    return NULL;
+}
+
+/* 创建 min(处理器数, NVA_PARALLEL_COPY_MAX_THREADS) - 1 个工作线程，调用者自己算作一个。
+ * 创建失败的线程不再重试，没有领取的块由调用者完成 */
+static void extPoolInit(void)
+{
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int workers;
+    unsigned int i;
+
+    ext_pool.cpus = (cpus > 0L) ? (unsigned int)cpus : 1U;
+    workers = ((ext_pool.cpus < NVA_PARALLEL_COPY_MAX_THREADS) ? ext_pool.cpus : NVA_PARALLEL_COPY_MAX_THREADS) - 1U;
+
+    for (i = 0U; i < workers; ++i) {
+        pthread_t worker;
+
+        if (pthread_create(&worker, NULL, extPoolWorker, NULL) != 0) {
+            break;
+        }
+        pthread_detach(worker);
+    }
+}
+
+#endif /* NVA_EXT_USE_PTHREADS */
+
+/* [dst, dst + n) 与 [src, src + n) 不重叠；切分为 threads 块交给线程池，调用者同样领取块 */
+static void extParallelCopy(unsigned char* const dst,
+                            const unsigned char* const src,
+                            const nva_Size n,
+                            unsigned int threads)
+{
+#ifdef NVA_EXT_USE_PTHREADS
+    ExtCopyTask tasks[NVA_PARALLEL_COPY_MAX_THREADS];
+    ExtCopyBatch batch;
+    nva_Size chunk;
+    nva_Size skew;
+    nva_Size begin = 0U;
+    unsigned int i;
+
+    if (n < NVA_PARALLEL_COPY_THRESHOLD) {
+        nva_memcpy(dst, src, n);
+        return;
+    }
+
+    pthread_once(&ext_pool_once, extPoolInit);
+
+    if (threads == 0U) {
+        threads = ext_pool.cpus;
+    }
+    if (threads > NVA_PARALLEL_COPY_MAX_THREADS) {
+        threads = NVA_PARALLEL_COPY_MAX_THREADS;
+    }
+    if (threads < 2U) {
+        nva_memcpy(dst, src, n);
+        return;
+    }
+
+    /* 块大小取缓存行的整数倍，第一块缩短 skew 字节，之后每块都从目的地址的缓存行边界开始；
+     * 最后一块延伸到末尾 */
+    chunk = ((n + threads - 1U) / threads + (EXT_CACHE_LINE - 1U)) & ~(nva_Size)(EXT_CACHE_LINE - 1U);
+    skew = (nva_Size)dst & (EXT_CACHE_LINE - 1U);
+
+    for (i = 0U; i < threads && begin < n; ++i) {
+        nva_Size end = (nva_Size)(i + 1U) * chunk - skew;
+
+        if (end > n || i + 1U == threads) {
+            end = n;
+        }
+        tasks[i].dst = dst + begin;
+        tasks[i].src = src + begin;
+        tasks[i].n = end - begin;
+        begin = end;
+    }
+
+    batch.tasks = tasks;
+    batch.count = i;
+    batch.next = 0U;
+    batch.remaining = i;
+    batch.link = NULL;
+
+    pthread_mutex_lock(&ext_pool.lock);
+    if (ext_pool.tail) {
+        ext_pool.tail->link = &batch;
+    }
+    else {
+        ext_pool.head = &batch;
+    }
+    ext_pool.tail = &batch;
+    pthread_cond_broadcast(&ext_pool.work);
+
+    /* 调用者也领取自己批次中的块，线程池被其他调用者占满时不会空等 */
+    while (batch.next < batch.count) {
+        const ExtCopyTask* const task = extPoolClaim(&batch);
+
+        pthread_mutex_unlock(&ext_pool.lock);
+        nva_memcpy(task->dst, task->src, task->n);
+        pthread_mutex_lock(&ext_pool.lock);
+
+        extPoolFinish(&batch);
+    }
+    while (batch.remaining > 0U) {
+        pthread_cond_wait(&ext_pool.done, &ext_pool.lock);
+    }
+    pthread_mutex_unlock(&ext_pool.lock);
+#else
+    (void)threads;
+    nva_memcpy(dst, src, n);
+#endif
+}
+
+void* nva_memcpyParallel(void* const dst, const void* const src, const nva_Size n, const unsigned int threads)
+{
+    if (n > 0U) {
+        extParallelCopy((unsigned char*)dst, (const unsigned char*)src, n, threads);
+    }
+
+    return dst;
+}
+
+void* nva_memmoveParallel(void* const dst, const void* const src, const nva_Size n, const unsigned int threads)
+{
+    unsigned char* const d = (unsigned char*)dst;
+    const unsigned char* const s = (const unsigned char*)src;
+    nva_Size dist;
+    nva_Size done;
+    nva_Size len;
+
+    if (n == 0U || d == s) {
+        return dst;
+    }
+
+    if (d + n <= s || s + n <= d) {
+        extParallelCopy(d, s, n, threads);
+        return dst;
+    }
+
+    dist = (d > s) ? (nva_Size)(d - s) : (nva_Size)(s - d);
+    if (dist < NVA_PARALLEL_COPY_THRESHOLD) {
+        return nva_memmove(dst, src, n);
+    }
+
+    /* 按地址差 dist 分段：同一段的源与目的互不重叠，目的只会覆盖已经拷贝完成的段的源。
+     * 目的在后时从末尾开始，目的在前时从开头开始，每段内部再切分到多个线程 */
+    for (done = 0U; done < n; done += len) {
+        len = (n - done < dist) ? n - done : dist;
+        if (d > s) {
+            extParallelCopy(d + (n - done - len), s + (n - done - len), len, threads);
+        }
+        else {
+            extParallelCopy(d + done, s + done, len, threads);
+        }
+    }
+
+    return dst;
+}
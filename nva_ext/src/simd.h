@@ -0,0 +1,49 @@
+/**
+ * @file simd.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief nva_ext 内部使用的向量指令集选择
+ *
+ * 按编译器开启的指令集定义 NVA_EXT_SSE2、NVA_EXT_SSSE3；定义 NVA_NO_SIMD 时都不定义，一律使用标量实现。
+ * 同时提供各向量路径共用的位运算辅助函数。
+ */
+
+#ifndef NVA_EXT_SIMD_H
+#define NVA_EXT_SIMD_H
+
+#ifndef NVA_NO_SIMD
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define NVA_EXT_SSE2
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define NVA_EXT_SSSE3
+#endif
+
+#endif /* !NVA_NO_SIMD */
+
+#ifdef NVA_EXT_SSE2
+/* mask 非 0，返回最低的置位。处理 movemask 的结果时与 mask &= mask - 1U 配合，依次取出每个置位 */
+#ifdef __GNUC__
+__attribute__((__unused__))
+#endif
+static unsigned int extLowestBit(unsigned int mask)
+{
+#ifdef __GNUC__
+    return (unsigned int)__builtin_ctz(mask);
+#else
+    unsigned int i = 0U;
+
+    while ((mask & 1U) == 0U) {
+        mask >>= 1U;
+        ++i;
+    }
+    return i;
+#endif
+}
+#endif /* NVA_EXT_SSE2 */
+
+#endif /* !NVA_EXT_SIMD_H */
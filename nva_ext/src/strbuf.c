@@ -0,0 +1,171 @@
+/**
+ * @file strbuf.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 记录长度的字符串构建器
+ */
+
+#include "nva/ext/strbuf.h"
+
+/* int/unsigned int 以二进制输出时最长的结果，含符号与 '\0' */
+#define EXT_INT_SCRATCH_SIZE   (sizeof(int) * 8U + 2U)
+
+/* double 以 {:f} 输出时最长的结果：309 位整数部分、小数点、最多 255 位小数、符号与 '\0' */
+#define EXT_FLOAT_SCRATCH_SIZE (309U + 1U + 255U + 2U)
+
+#if NVA_STRBUF_FORMAT_SIZE > EXT_FLOAT_SCRATCH_SIZE
+#define EXT_STRBUF_SCRATCH_SIZE NVA_STRBUF_FORMAT_SIZE
+#else
+#define EXT_STRBUF_SCRATCH_SIZE EXT_FLOAT_SCRATCH_SIZE
+#endif
+
+/* 剩余空间放不下最长结果时，浮点数与格式化结果先写在这里。放在静态存储区而不占用调用者的栈，
+ * nva_format 的参数栈本身就是全局的，这里同样不可重入 */
+static char ext_strbuf_scratch[EXT_STRBUF_SCRATCH_SIZE];
+
+/* 剩余空间足够时把 [src, src + len) 追加到末尾 */
+static nva_ErrorCode extStrBufAppend(nva_StrBuf* const sb, const char* const src, const nva_Size len)
+{
+    if (len > sb->cap - 1U - sb->len) {
+        return NVA_FAIL;
+    }
+
+    nva_memcpy(sb->buf + sb->len, src, len);
+    sb->len += len;
+    sb->buf[sb->len] = '\0';
+
+    return NVA_SUCCESS;
+}
+
+/* 剩余空间至少有 need 字节时直接写在末尾，否则写入暂存区 */
+static char* extStrBufTail(const nva_StrBuf* const sb, const nva_Size need)
+{
+    return (sb->cap - sb->len >= need) ? sb->buf + sb->len : ext_strbuf_scratch;
+}
+
+/* 提交写在 dst 中的 len 个字符：直接写在末尾的只需更新长度，暂存区中的按剩余空间检查后复制 */
+static nva_ErrorCode extStrBufCommit(nva_StrBuf* const sb, const char* const dst, const nva_Size len)
+{
+    if (dst != sb->buf + sb->len) {
+        return extStrBufAppend(sb, dst, len);
+    }
+
+    sb->len += len;
+    sb->buf[sb->len] = '\0';
+
+    return NVA_SUCCESS;
+}
+
+nva_ErrorCode nva_strBufInit(nva_StrBuf* const sb, char* const buf, const nva_Size cap)
+{
+    if (!sb || !buf || cap == 0U) {
+        return NVA_PARAM_ERROR;
+    }
+
+    sb->buf = buf;
+    sb->len = 0U;
+    sb->cap = cap;
+    buf[0] = '\0';
+
+    return NVA_SUCCESS;
+}
+
+void nva_strBufClear(nva_StrBuf* const sb)
+{
+    if (sb) {
+        sb->len = 0U;
+        sb->buf[0] = '\0';
+    }
+}
+
+nva_ErrorCode nva_strBufAppendStr(nva_StrBuf* const sb, const char* const str)
+{
+    if (!sb || !str) {
+        return NVA_PARAM_ERROR;
+    }
+
+    return extStrBufAppend(sb, str, nva_strlen(str));
+}
+
+nva_ErrorCode nva_strBufAppendChar(nva_StrBuf* const sb, const char c)
+{
+    if (!sb) {
+        return NVA_PARAM_ERROR;
+    }
+
+    return extStrBufAppend(sb, &c, 1U);
+}
+
+nva_ErrorCode nva_strBufAppendInt(nva_StrBuf* const sb, const int value, const nva_NumToStringAttr* attr)
+{
+    static const nva_NumToStringAttr dec = {10U, 0U};
+    char scratch[EXT_INT_SCRATCH_SIZE];
+    unsigned int width = 0U;
+
+    if (!sb) {
+        return NVA_PARAM_ERROR;
+    }
+
+    nva_itoa(value, scratch, attr ? attr : &dec, &width);
+
+    return extStrBufAppend(sb, scratch, width);
+}
+
+nva_ErrorCode nva_strBufAppendUint(nva_StrBuf* const sb, const unsigned int value, const nva_NumToStringAttr* attr)
+{
+    static const nva_NumToStringAttr dec = {10U, 0U};
+    char scratch[EXT_INT_SCRATCH_SIZE];
+    unsigned int width = 0U;
+
+    if (!sb) {
+        return NVA_PARAM_ERROR;
+    }
+
+    nva_uitoa(value, scratch, attr ? attr : &dec, &width);
+
+    return extStrBufAppend(sb, scratch, width);
+}
+
+nva_ErrorCode nva_strBufAppendFloat(nva_StrBuf* const sb, const double value, const nva_FloatPointToStrAttr* attr)
+{
+    nva_FloatPointToStrAttr def;
+    char* dst;
+
+    if (!sb) {
+        return NVA_PARAM_ERROR;
+    }
+
+    if (!attr) {
+        def.base = 10U;
+        def.precision = 6U;
+        def.flag.keep_decimal_point = 0U;
+        def.flag.upper_case = 0U;
+        def.flag.type = NVA_FP_TO_STR_TYPE_F;
+        attr = &def;
+    }
+
+    dst = extStrBufTail(sb, EXT_FLOAT_SCRATCH_SIZE);
+
+    return extStrBufCommit(sb, dst, nva_fptoa(value, dst, attr));
+}
+
+nva_ErrorCode nva_strBufAppendFormat(nva_StrBuf* const sb, const char* const format, const nva_ErrorCode status)
+{
+    nva_ErrorCode code;
+    char* dst;
+
+    if (!sb) {
+        /* 仍然交给 nva_format，清空已经压入的参数 */
+        (void)nva_format(ext_strbuf_scratch, format, NVA_PARAM_ERROR);
+        return NVA_PARAM_ERROR;
+    }
+
+    dst = extStrBufTail(sb, NVA_STRBUF_FORMAT_SIZE);
+    code = nva_format(dst, format, status);
+    if (code != NVA_SUCCESS) {
+        sb->buf[sb->len] = '\0';
+        return code;
+    }
+
+    return extStrBufCommit(sb, dst, nva_strlen(dst));
+}
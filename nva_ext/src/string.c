@@ -0,0 +1,179 @@
+/**
+ * @file string.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief nva/string.h 之外的内存操作函数
+ */
+
+#include "nva/ext/string.h"
+
+#include "simd.h"
+
+/* 按字读写时使用的类型，GCC/Clang 下允许与任意类型别名 */
+#ifdef __GNUC__
+typedef unsigned long __attribute__((__may_alias__)) ExtWord;
+#else
+typedef unsigned long ExtWord;
+#endif
+
+#define EXT_WORD_SIZE        (sizeof(ExtWord))
+#define EXT_WORD_OFFSET(p)   ((nva_Size)(p) & (EXT_WORD_SIZE - 1U))
+
+/* 每个字节都是 0x01 / 0x80 的字；EXT_HAS_ZERO_BYTE(v) 在 v 含有值为 0 的字节时非 0 */
+#define EXT_WORD_ONES        ((ExtWord)-1 / 0xFFU)
+#define EXT_WORD_HIGHS       (EXT_WORD_ONES * 0x80U)
+#define EXT_HAS_ZERO_BYTE(v) (((v) - EXT_WORD_ONES) & ~(v) & EXT_WORD_HIGHS)
+
+int nva_memcmp(const void* const lhs, const void* const rhs, nva_Size n)
+{
+    const unsigned char* a = (const unsigned char*)lhs;
+    const unsigned char* b = (const unsigned char*)rhs;
+
+#ifdef NVA_EXT_SSE2
+    while (n >= 16U) {
+        const __m128i x = _mm_loadu_si128((const __m128i*)a);
+        const __m128i y = _mm_loadu_si128((const __m128i*)b);
+        const unsigned int diff = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFFU;
+
+        if (diff != 0U) {
+            const unsigned int i = extLowestBit(diff);
+            return (int)a[i] - (int)b[i];
+        }
+        a += 16U;
+        b += 16U;
+        n -= 16U;
+    }
+#else
+    /* 两侧对齐相同时先逐字节对齐，再逐字比较；遇到不同的字交给下面的逐字节比较找出位置 */
+    if (EXT_WORD_OFFSET(a) == EXT_WORD_OFFSET(b)) {
+        while (n > 0U && EXT_WORD_OFFSET(a) != 0U) {
+            if (*a != *b) {
+                return (int)*a - (int)*b;
+            }
+            ++a;
+            ++b;
+            --n;
+        }
+        while (n >= EXT_WORD_SIZE && *(const ExtWord*)a == *(const ExtWord*)b) {
+            a += EXT_WORD_SIZE;
+            b += EXT_WORD_SIZE;
+            n -= EXT_WORD_SIZE;
+        }
+    }
+#endif
+
+    while (n > 0U) {
+        if (*a != *b) {
+            return (int)*a - (int)*b;
+        }
+        ++a;
+        ++b;
+        --n;
+    }
+
+    return 0;
+}
+
+void* nva_memset(void* const dst, const int c, nva_Size n)
+{
+    unsigned char* d = (unsigned char*)dst;
+    const unsigned char byte = (unsigned char)c;
+
+    while (n > 0U && EXT_WORD_OFFSET(d) != 0U) {
+        *d++ = byte;
+        --n;
+    }
+
+#ifdef NVA_EXT_SSE2
+    {
+        const __m128i fill = _mm_set1_epi8((char)byte);
+
+        while (n >= 16U) {
+            _mm_storeu_si128((__m128i*)d, fill);
+            d += 16U;
+            n -= 16U;
+        }
+    }
+#endif
+
+    {
+        const ExtWord fill = EXT_WORD_ONES * byte;
+
+        while (n >= EXT_WORD_SIZE) {
+            *(ExtWord*)d = fill;
+            d += EXT_WORD_SIZE;
+            n -= EXT_WORD_SIZE;
+        }
+    }
+
+    while (n > 0U) {
+        *d++ = byte;
+        --n;
+    }
+
+    return dst;
+}
+
+void* nva_memchr(const void* const src, const int c, const nva_Size n)
+{
+    return nva_memchr2(src, c, c, n);
+}
+
+void* nva_memchr2(const void* const src, const int c1, const int c2, nva_Size n)
+{
+    const unsigned char* s = (const unsigned char*)src;
+    const unsigned char b1 = (unsigned char)c1;
+    const unsigned char b2 = (unsigned char)c2;
+
+#ifdef NVA_EXT_SSE2
+    {
+        const __m128i v1 = _mm_set1_epi8((char)b1);
+        const __m128i v2 = _mm_set1_epi8((char)b2);
+
+        while (n >= 16U) {
+            const __m128i x = _mm_loadu_si128((const __m128i*)s);
+            const unsigned int hit =
+                (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, v1), _mm_cmpeq_epi8(x, v2)));
+
+            if (hit != 0U) {
+                return (void*)(s + extLowestBit(hit));
+            }
+            s += 16U;
+            n -= 16U;
+        }
+    }
+#else
+    {
+        const ExtWord p1 = EXT_WORD_ONES * b1;
+        const ExtWord p2 = EXT_WORD_ONES * b2;
+
+        while (n > 0U && EXT_WORD_OFFSET(s) != 0U) {
+            if (*s == b1 || *s == b2) {
+                return (void*)s;
+            }
+            ++s;
+            --n;
+        }
+        /* 命中的字交给下面的逐字节查找确定位置 */
+        while (n >= EXT_WORD_SIZE) {
+            const ExtWord x = *(const ExtWord*)s;
+
+            if (EXT_HAS_ZERO_BYTE(x ^ p1) || EXT_HAS_ZERO_BYTE(x ^ p2)) {
+                break;
+            }
+            s += EXT_WORD_SIZE;
+            n -= EXT_WORD_SIZE;
+        }
+    }
+#endif
+
+    while (n > 0U) {
+        if (*s == b1 || *s == b2) {
+            return (void*)s;
+        }
+        ++s;
+        --n;
+    }
+
+    return NULL;
+}
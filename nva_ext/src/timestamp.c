@@ -0,0 +1,103 @@
+/**
+ * @file timestamp.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 日志行时间戳前缀 YYYY-MM-DD HH:MM:SS.uuuuuu（UTC）
+ */
+
+#include "nva/ext/string.h"
+#include "nva/ext/timestamp.h"
+
+/* 10000-01-01 00:00:00 的 Unix 时间 */
+#define EXT_TIMESTAMP_MAX_SEC 253402300800ULL
+
+#define EXT_SECONDS_PER_DAY   86400UL
+
+/* 00~99 的两位十进制字符 */
+static const char ext_digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static void extPut2(char* const dst, const unsigned long value)
+{
+    dst[0] = ext_digit_pairs[2U * value];
+    dst[1] = ext_digit_pairs[2U * value + 1U];
+}
+
+/* 由 1970-01-01 起的天数计算公历日期，按 3 月为一年之始，闰日落在年末 */
+static void extRenderSecond(char* const text, const unsigned long long sec)
+{
+    const unsigned long days = (unsigned long)(sec / EXT_SECONDS_PER_DAY);
+    const unsigned long rem = (unsigned long)(sec % EXT_SECONDS_PER_DAY);
+    const unsigned long z = days + 719468UL; /* 以 0000-03-01 为第 0 天 */
+    const unsigned long era = z / 146097UL;  /* 400 年为一个周期 */
+    const unsigned long doe = z - era * 146097UL;
+    const unsigned long yoe = (doe - doe / 1460UL + doe / 36524UL - doe / 146096UL) / 365UL;
+    const unsigned long doy = doe - (365UL * yoe + yoe / 4UL - yoe / 100UL);
+    const unsigned long mp = (5UL * doy + 2UL) / 153UL;
+    const unsigned long day = doy - (153UL * mp + 2UL) / 5UL + 1UL;
+    const unsigned long month = (mp < 10UL) ? mp + 3UL : mp - 9UL;
+    const unsigned long year = yoe + era * 400UL + ((month <= 2UL) ? 1UL : 0UL);
+
+    extPut2(text, year / 100UL);
+    extPut2(text + 2, year % 100UL);
+    text[4] = '-';
+    extPut2(text + 5, month);
+    text[7] = '-';
+    extPut2(text + 8, day);
+    text[10] = ' ';
+    extPut2(text + 11, rem / 3600UL);
+    text[13] = ':';
+    extPut2(text + 14, rem / 60UL % 60UL);
+    text[16] = ':';
+    extPut2(text + 17, rem % 60UL);
+    text[19] = '.';
+}
+
+nva_ErrorCode nva_timestampCacheInit(nva_TimestampCache* const cache)
+{
+    if (!cache) {
+        return NVA_PARAM_ERROR;
+    }
+
+    cache->valid = 0U;
+
+    return NVA_SUCCESS;
+}
+
+nva_ErrorCode nva_timestampRender(nva_TimestampCache* const cache,
+                                  const unsigned long long sec,
+                                  const unsigned long usec,
+                                  char* const dst)
+{
+    if (!cache || !dst || usec >= 1000000UL) {
+        return NVA_PARAM_ERROR;
+    }
+    if (sec >= EXT_TIMESTAMP_MAX_SEC) {
+        return NVA_FAIL;
+    }
+
+    if (!cache->valid || cache->sec != sec) {
+        extRenderSecond(cache->text, sec);
+        cache->sec = sec;
+        cache->valid = 1U;
+    }
+
+    /* 秒级部分按 16 + 4 字节拷贝，微秒部分每次两位 */
+    NVA_MEMCPY_CONST(dst, cache->text, 16U);
+    NVA_MEMCPY_CONST(dst + 16, cache->text + 16, 4U);
+    extPut2(dst + 20, usec / 10000UL);
+    extPut2(dst + 22, usec / 100UL % 100UL);
+    extPut2(dst + 24, usec % 100UL);
+    dst[NVA_TIMESTAMP_LEN] = '\0';
+
+    return NVA_SUCCESS;
+}
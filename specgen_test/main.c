@@ -0,0 +1,75 @@
+/**
+ * @file main.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 比较 nva_specgen 专用化后的调用与原始调用的输出
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "specgen_calls.h"
+
+static char print_buffer[256];
+static unsigned int print_index;
+
+int nva_putchar(const char c)
+{
+    if (print_index >= sizeof(print_buffer) - 1U) {
+        return -1;
+    }
+
+    print_buffer[print_index++] = c;
+    print_buffer[print_index] = '\0';
+
+    return 1;
+}
+
+int main(void)
+{
+    static char specgen_out[SPECGEN_CASE_NUM][SPECGEN_OUT_SIZE];
+    static char generic_out[SPECGEN_CASE_NUM][SPECGEN_OUT_SIZE];
+    nva_ErrorCode specgen_codes[SPECGEN_CASE_NUM];
+    nva_ErrorCode generic_codes[SPECGEN_CASE_NUM];
+    char generic_print[sizeof(print_buffer)];
+    int failures = 0;
+    int n;
+    int i;
+
+    n = specgen_formatCalls(specgen_out, specgen_codes);
+    if (generic_formatCalls(generic_out, generic_codes) != n) {
+        printf("case count mismatch\n");
+        return 1;
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (specgen_codes[i] != generic_codes[i] ||
+            (generic_codes[i] == NVA_SUCCESS && strcmp(specgen_out[i], generic_out[i]) != 0)) {
+            printf("case %d: specgen (%d) \"%s\" != generic (%d) \"%s\"\n",
+                   i,
+                   (int)specgen_codes[i],
+                   specgen_out[i],
+                   (int)generic_codes[i],
+                   generic_out[i]);
+            ++failures;
+        }
+    }
+
+    print_index = 0U;
+    print_buffer[0] = '\0';
+    generic_printCalls();
+    strcpy(generic_print, print_buffer);
+
+    print_index = 0U;
+    print_buffer[0] = '\0';
+    specgen_printCalls();
+
+    if (strcmp(print_buffer, generic_print) != 0) {
+        printf("print: specgen \"%s\" != generic \"%s\"\n", print_buffer, generic_print);
+        ++failures;
+    }
+
+    printf("%d format cases and 1 print case, %d failures\n", n, failures);
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,18 @@
+/**
+ * @file nva_user_options.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief specgen_test 用户配置头文件
+ */
+
+#pragma once
+#ifndef NVA_NVA_USER_OPTIONS_H
+#define NVA_NVA_USER_OPTIONS_H
+
+#define NVA_NO_STDDEF_H
+#define NVA_NO_STDBOOL_H
+#define NVA_NO_STRING_H
+
+#define NVA_SIZE_T unsigned long long
+
+#endif // !NVA_NVA_USER_OPTIONS_H
@@ -0,0 +1,83 @@
+/**
+ * @file specgen_calls.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 交给 nva_specgen 改写的调用
+ *
+ * 同一份源文件编译两次：改写后的版本链接为 specgen_*，原样编译的版本（定义 SPECGEN_GENERIC）链接为 generic_*。
+ */
+
+#include "specgen_calls.h"
+
+#ifdef SPECGEN_GENERIC
+#define specgen_formatCalls generic_formatCalls
+#define specgen_printCalls  generic_printCalls
+#endif
+
+int specgen_formatCalls(char (*out)[SPECGEN_OUT_SIZE], nva_ErrorCode* codes)
+{
+    const char* name = "nva_print";
+    const char* empty = "";
+    int value = -12345;
+    unsigned int mask = 0xBEEFU;
+    short temperature = -40;
+    unsigned short port = 8080U;
+    long big = 1234567L;
+    int i = 0;
+
+    codes[i] = nva_format(out[i], "value = {}", nva_int(value, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "{}|{:d}|{:>8}|{:<8}|{:*^9}", nva_int(0, nva_int(7, nva_int(-7, nva_int(42, nva_int(value, NVA_START))))));
+    ++i;
+    codes[i] = nva_format(out[i], "{:x} {:X} {:o} {:b}", nva_uint(mask, nva_uint(mask, nva_uint(8U, nva_uint(5U, NVA_START)))));
+    ++i;
+    codes[i] = nva_format(out[i], "[{:08x}] [{:#x}] [{:+d}]", nva_uint(mask, nva_uint(mask, nva_int(value, NVA_START))));
+    ++i;
+    codes[i] = nva_format(out[i], "{} {}", nva_short(temperature, nva_ushort(port, NVA_START)));
+    ++i;
+    codes[i] = nva_format(out[i], "hello, {}!", nva_str(name, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "[{:>12}] [{:<12}] [{:-^13}]", nva_str(name, nva_str(name, nva_str(name, NVA_START))));
+    ++i;
+    codes[i] = nva_format(out[i], "[{}] [{:.3}]", nva_str(empty, nva_str(name, NVA_START)));
+    ++i;
+    codes[i] = nva_format(out[i], "{}{}{:>3}{:<3}|", nva_char('a', nva_char('b', nva_char('c', nva_char('d', NVA_START)))));
+    ++i;
+    codes[i] = nva_format(out[i], "{1} {0} {1}", nva_str("world", nva_str("hello", NVA_START)));
+    ++i;
+    codes[i] = nva_format(out[i], "{{}} {{{}}} }}{{", nva_int(1, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "tab\there\nnew line \"quoted\" {}", nva_int(2, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "split "
+                                  "literal {}",
+                          nva_int(3, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "{:.2f} {:8.3f} {}", nva_double(3.14159, nva_double(-2.5, nva_float(0.5f, NVA_START))));
+    ++i;
+    codes[i] = nva_format(out[i], "{} {:>10}", nva_long(big, nva_long(-big, NVA_START)));
+    ++i;
+    codes[i] = nva_format(out[i], "{:x}", nva_int(-0xdf, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "{}", nva_int(value + 1 > 0 ? 1 : (int)sizeof(long), NVA_START));
+    ++i;
+
+    /* 以下调用不会被专用化 */
+    codes[i] = nva_format(out[i], name, NVA_START);
+    ++i;
+    codes[i] = nva_format(out[i], "{} {}", nva_int(1, NVA_START));
+    ++i;
+    codes[i] = nva_format(out[i], "no fields", NVA_START);
+    ++i;
+
+    return i;
+}
+
+void specgen_printCalls(void)
+{
+    int count = 3;
+
+    nva_print("{} items\n", nva_int(count, NVA_START));
+    nva_print("[{:>6}] {}: {:x}\n", nva_str("INFO", nva_str("sensor", nva_uint(0x2AU, NVA_START))));
+    nva_print("{:.1f}%\n", nva_double(99.5, NVA_START));
+}
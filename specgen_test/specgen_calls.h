@@ -0,0 +1,23 @@
+/**
+ * @file specgen_calls.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 交给 nva_specgen 改写的调用
+ */
+
+#ifndef SPECGEN_CALLS_H
+#define SPECGEN_CALLS_H
+
+#include "nva/print.h"
+
+#define SPECGEN_CASE_NUM 24
+#define SPECGEN_OUT_SIZE 96
+
+/* 返回实际执行的用例数 */
+int specgen_formatCalls(char (*out)[SPECGEN_OUT_SIZE], nva_ErrorCode* codes);
+int generic_formatCalls(char (*out)[SPECGEN_OUT_SIZE], nva_ErrorCode* codes);
+
+void specgen_printCalls(void);
+void generic_printCalls(void);
+
+#endif /* !SPECGEN_CALLS_H */
@@ -0,0 +1,50 @@
+# nva_specgen(<target> SOURCES <file>...)
+#
+# 在构建时用 nva_specgen 改写 SOURCES 中的 C 源文件，并把改写后的副本与生成的专用函数加入 <target>。
+# SOURCES 中的文件不要再直接加入 <target>。定义 NVA_SPECGEN_DISABLE 可以让所有调用退回 nva_format/nva_print。
+#
+# 交叉编译时主机上的 nva_specgen 无法作为同一工程的目标构建，此时请设置 NVA_SPECGEN_EXECUTABLE。
+
+function(nva_specgen target)
+    cmake_parse_arguments(ARG "" "" "SOURCES" ${ARGN})
+
+    if (DEFINED NVA_SPECGEN_EXECUTABLE)
+        set(generator ${NVA_SPECGEN_EXECUTABLE})
+        set(generator_depends "")
+    else ()
+        set(generator $<TARGET_FILE:nva_specgen>)
+        set(generator_depends nva_specgen)
+    endif ()
+
+    set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/${target}_specgen)
+    file(MAKE_DIRECTORY ${out_dir})
+
+    set(inputs "")
+    set(outputs ${out_dir}/nva_specgen.h ${out_dir}/nva_specgen.c)
+    set(include_dirs "")
+
+    foreach (source IN LISTS ARG_SOURCES)
+        get_filename_component(source ${source} ABSOLUTE)
+        get_filename_component(source_name ${source} NAME)
+        get_filename_component(source_dir ${source} DIRECTORY)
+
+        list(APPEND inputs ${source})
+        list(APPEND outputs ${out_dir}/${source_name})
+        list(APPEND include_dirs ${source_dir})
+    endforeach ()
+
+    list(REMOVE_DUPLICATES include_dirs)
+
+    add_custom_command(
+        OUTPUT ${outputs}
+        COMMAND ${generator} --out-dir ${out_dir} ${inputs}
+        DEPENDS ${generator_depends} ${inputs}
+        COMMENT "Specializing nva_print calls for ${target}"
+        VERBATIM
+    )
+
+    target_sources(${target} PRIVATE ${outputs})
+
+    # 改写后的副本位于构建目录中，原目录中的头文件需要通过包含路径找到
+    target_include_directories(${target} PRIVATE ${out_dir} ${include_dirs})
+endfunction()
@@ -0,0 +1,864 @@
+/**
+ * @file nva_specgen.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 构建期代码生成器：为字面量格式字符串的 nva_format/nva_print 调用生成专用的 C 函数
+ *
+ * 用法：nva_specgen --out-dir <dir> <source.c>...
+ *
+ * 对每个源文件生成一份改写后的副本，其中可以专用化的调用被替换为 NVA_SPECGEN_<n>(...) 宏；
+ * 所有专用函数写入 <dir>/nva_specgen.h 与 <dir>/nva_specgen.c。生成的代码遵循 C90。
+ *
+ * 可以专用化的调用需要满足：
+ * 1. 格式字符串是（可能相邻拼接的）字符串字面量；
+ * 2. 参数链只由下表中的构造函数组成，并以 NVA_START 结束；
+ * 3. 格式字符串中的字段可以在编译期解析，且参数个数与字段一致。
+ * 其余调用保持原样。字段的规格为 [[fill]align][width][type] 且类型为整数、字符或字符串时直接展开，
+ * 否则对该字段调用一次只含该字段的 nva_format/nva_print。
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+enum class Kind {
+    SIGNED,    // 以 nva_itoa 展开
+    UNSIGNED,  // 以 nva_uitoa 展开
+    CHAR,
+    STRING,
+    OTHER,  // 只能逐字段回退
+};
+
+struct Constructor {
+    std::string_view name;
+    std::string_view c_type;
+    Kind kind;
+};
+
+/* long long 不在 C90 中，相关调用保持原样 */
+constexpr Constructor constructors[] = {
+    {"nva_int", "int", Kind::SIGNED},
+    {"nva_short", "short", Kind::SIGNED},
+    {"nva_uint", "unsigned int", Kind::UNSIGNED},
+    {"nva_ushort", "unsigned short", Kind::UNSIGNED},
+    {"nva_long", "long", Kind::OTHER},
+    {"nva_ulong", "unsigned long", Kind::OTHER},
+    {"nva_schar", "signed char", Kind::OTHER},
+    {"nva_uchar", "unsigned char", Kind::OTHER},
+    {"nva_char", "char", Kind::CHAR},
+    {"nva_str", "const char*", Kind::STRING},
+    {"nva_ptr", "const void*", Kind::OTHER},
+    {"nva_float", "float", Kind::OTHER},
+    {"nva_double", "double", Kind::OTHER},
+};
+
+struct Argument {
+    const Constructor* ctor;
+    std::string expr;
+};
+
+struct Field {
+    std::size_t arg;
+    std::string spec;
+};
+
+/* 格式字符串被拆分为交替的字面量与字段，literals.size() == fields.size() + 1 */
+struct ParsedFormat {
+    std::vector<std::string> literals;
+    std::vector<Field> fields;
+};
+
+struct CallSite {
+    bool is_print;
+    std::string dst;
+    std::string format;  // 原始的字面量文本，用于 NVA_SPECGEN_DISABLE 时的回退
+    ParsedFormat parsed;
+    std::vector<Argument> args;
+};
+
+bool is_ident_char(const char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+std::string trim(std::string_view s)
+{
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front()))) s.remove_prefix(1);
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back()))) s.remove_suffix(1);
+    return std::string{s};
+}
+
+/* 跳过从 i 开始的字符串或字符字面量，返回结束引号之后的位置 */
+std::size_t skip_quoted(const std::string& text, std::size_t i)
+{
+    const char quote = text[i++];
+
+    while (i < text.size() && text[i] != quote) {
+        if (text[i] == '\\') ++i;
+        ++i;
+    }
+
+    return (i < text.size()) ? i + 1 : i;
+}
+
+/* 跳过注释，返回注释之后的位置；i 处不是注释时原样返回 */
+std::size_t skip_comment(const std::string& text, const std::size_t i)
+{
+    if (text.compare(i, 2, "//") == 0) {
+        const std::size_t end = text.find('\n', i);
+        return (end == std::string::npos) ? text.size() : end;
+    }
+    if (text.compare(i, 2, "/*") == 0) {
+        const std::size_t end = text.find("*/", i + 2);
+        return (end == std::string::npos) ? text.size() : end + 2;
+    }
+
+    return i;
+}
+
+/* 从 open（指向 '('）开始，按顶层逗号拆分参数；返回 ')' 之后的位置，括号不匹配时返回 npos */
+std::size_t split_args(const std::string& text, const std::size_t open, std::vector<std::string>& args)
+{
+    int depth = 0;
+    std::size_t begin = open + 1;
+
+    for (std::size_t i = open; i < text.size();) {
+        const char c = text[i];
+
+        if (c == '"' || c == '\'') {
+            i = skip_quoted(text, i);
+            continue;
+        }
+        if (const std::size_t next = skip_comment(text, i); next != i) {
+            i = next;
+            continue;
+        }
+
+        if (c == '(' || c == '[' || c == '{') {
+            ++depth;
+        }
+        else if (c == ')' || c == ']' || c == '}') {
+            if (--depth == 0) {
+                args.push_back(trim(std::string_view{text}.substr(begin, i - begin)));
+                return i + 1;
+            }
+        }
+        else if (c == ',' && depth == 1) {
+            args.push_back(trim(std::string_view{text}.substr(begin, i - begin)));
+            begin = i + 1;
+        }
+        ++i;
+    }
+
+    return std::string::npos;
+}
+
+/* 解码由字符串字面量（允许相邻拼接）组成的表达式；不是纯字面量时返回空 */
+std::optional<std::string> decode_literal(const std::string& expr)
+{
+    std::string out;
+    std::size_t i = 0U;
+    bool any = false;
+
+    while (i < expr.size()) {
+        if (std::isspace(static_cast<unsigned char>(expr[i]))) {
+            ++i;
+            continue;
+        }
+        if (expr[i] != '"') return std::nullopt;
+
+        any = true;
+        for (++i; i < expr.size() && expr[i] != '"'; ++i) {
+            if (expr[i] != '\\') {
+                out += expr[i];
+                continue;
+            }
+
+            const char e = expr[++i];
+            switch (e) {
+                case 'n': out += '\n'; break;
+                case 't': out += '\t'; break;
+                case 'r': out += '\r'; break;
+                case 'a': out += '\a'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'v': out += '\v'; break;
+                case 'x': {
+                    unsigned int value = 0U;
+                    while (i + 1 < expr.size() && std::isxdigit(static_cast<unsigned char>(expr[i + 1]))) {
+                        value = value * 16U + std::stoul(std::string{expr[++i]}, nullptr, 16);
+                    }
+                    out += static_cast<char>(value);
+                    break;
+                }
+                default:
+                    if (e >= '0' && e <= '7') {
+                        unsigned int value = static_cast<unsigned int>(e - '0');
+                        for (int n = 0; n < 2 && i + 1 < expr.size() && expr[i + 1] >= '0' && expr[i + 1] <= '7'; ++n) {
+                            value = value * 8U + static_cast<unsigned int>(expr[++i] - '0');
+                        }
+                        out += static_cast<char>(value);
+                    }
+                    else {
+                        out += e;  // \\ \" \' \?
+                    }
+                    break;
+            }
+        }
+        if (i >= expr.size()) return std::nullopt;
+        ++i;
+    }
+
+    return any ? std::optional<std::string>{out} : std::nullopt;
+}
+
+/* 把任意字节串编码为 C 字符串字面量 */
+std::string encode_literal(const std::string& s)
+{
+    std::string out = "\"";
+
+    for (const char c : s) {
+        switch (c) {
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            case '\r': out += "\\r"; break;
+            case '\\': out += "\\\\"; break;
+            case '"': out += "\\\""; break;
+            case '?': out += "\\?"; break;  // 避免三字符组
+            default:
+                if (std::isprint(static_cast<unsigned char>(c))) {
+                    out += c;
+                }
+                else {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\%03o", static_cast<unsigned char>(c));
+                    out += buf;
+                }
+                break;
+        }
+    }
+
+    return out + "\"";
+}
+
+/* 解析参数链 ctor(expr, ctor(expr, ... NVA_START)) */
+bool parse_chain(const std::string& expr, std::vector<Argument>& args)
+{
+    if (expr == "NVA_START") return true;
+
+    std::size_t name_end = 0U;
+    while (name_end < expr.size() && is_ident_char(expr[name_end])) ++name_end;
+
+    const Constructor* ctor = nullptr;
+    for (const auto& c : constructors) {
+        if (c.name == std::string_view{expr}.substr(0, name_end)) ctor = &c;
+    }
+    if (ctor == nullptr) return false;
+
+    std::size_t open = name_end;
+    while (open < expr.size() && std::isspace(static_cast<unsigned char>(expr[open]))) ++open;
+    if (open >= expr.size() || expr[open] != '(') return false;
+
+    std::vector<std::string> parts;
+    if (split_args(expr, open, parts) != expr.size() || parts.size() != 2U) return false;
+
+    args.push_back({ctor, parts[0]});
+    return parse_chain(parts[1], args);
+}
+
+std::optional<ParsedFormat> parse_format(const std::string& format, const std::size_t arg_num)
+{
+    ParsedFormat parsed;
+    std::string literal;
+    std::size_t next_auto = 0U;
+    bool manual = false;
+
+    for (std::size_t i = 0U; i < format.size(); ++i) {
+        const char c = format[i];
+
+        if (c == '}') {
+            if (i + 1 >= format.size() || format[i + 1] != '}') return std::nullopt;
+            literal += '}';
+            ++i;
+            continue;
+        }
+        if (c != '{') {
+            literal += c;
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '{') {
+            literal += '{';
+            ++i;
+            continue;
+        }
+
+        const std::size_t close = format.find('}', i);
+        if (close == std::string::npos) return std::nullopt;
+
+        const std::string content = format.substr(i + 1, close - i - 1);
+        if (content.find('{') != std::string::npos) return std::nullopt;  // 不支持嵌套字段
+
+        const std::size_t colon = content.find(':');
+        const std::string index = content.substr(0, colon);
+        Field field;
+        field.spec = (colon == std::string::npos) ? "" : content.substr(colon + 1);
+
+        if (index.empty()) {
+            if (manual) return std::nullopt;
+            field.arg = next_auto++;
+        }
+        else {
+            if (next_auto != 0U || index.find_first_not_of("0123456789") != std::string::npos) return std::nullopt;
+            manual = true;
+            field.arg = std::stoul(index);
+        }
+        if (field.arg >= arg_num) return std::nullopt;
+
+        parsed.literals.push_back(literal);
+        parsed.fields.push_back(field);
+        literal.clear();
+        i = close;
+    }
+    parsed.literals.push_back(literal);
+
+    return parsed;
+}
+
+/* 可以直接展开的字段规格 */
+struct DirectSpec {
+    char fill;
+    char align;
+    unsigned long width;
+    unsigned int base;
+    bool upper_case;
+};
+
+std::optional<DirectSpec> decode_direct(const std::string& spec, const Kind kind)
+{
+    if (kind == Kind::OTHER) return std::nullopt;
+
+    DirectSpec direct{' ', (kind == Kind::SIGNED || kind == Kind::UNSIGNED) ? '>' : '<', 0U, 10U, false};
+    std::size_t i = 0U;
+
+    if (spec.size() >= 2U && std::string_view{"<>^"}.find(spec[1]) != std::string_view::npos) {
+        direct.fill = spec[0];
+        direct.align = spec[1];
+        i = 2U;
+    }
+    else if (!spec.empty() && std::string_view{"<>^"}.find(spec[0]) != std::string_view::npos) {
+        direct.align = spec[0];
+        i = 1U;
+    }
+
+    if (i < spec.size() && spec[i] == '0') return std::nullopt;  // 补零交给库处理
+    while (i < spec.size() && std::isdigit(static_cast<unsigned char>(spec[i]))) {
+        direct.width = direct.width * 10U + static_cast<unsigned long>(spec[i++] - '0');
+    }
+
+    const std::string type = spec.substr(i);
+    switch (kind) {
+        case Kind::SIGNED:
+            return (type.empty() || type == "d") ? std::optional{direct} : std::nullopt;
+        case Kind::UNSIGNED:
+            if (type.empty() || type == "d") return direct;
+            if (type.size() != 1U) return std::nullopt;
+            switch (type[0]) {
+                case 'x': direct.base = 16U; return direct;
+                case 'X': direct.base = 16U; direct.upper_case = true; return direct;
+                case 'o': direct.base = 8U; return direct;
+                case 'b': direct.base = 2U; return direct;
+                default: return std::nullopt;
+            }
+        case Kind::CHAR:
+            return (type.empty() || type == "c") ? std::optional{direct} : std::nullopt;
+        case Kind::STRING:
+            return (type.empty() || type == "s") ? std::optional{direct} : std::nullopt;
+        default:
+            return std::nullopt;
+    }
+}
+
+std::string char_literal(const char c)
+{
+    if (c == '\'' || c == '\\') return std::string{"'\\"} + c + "'";
+    return std::string{"'"} + c + "'";
+}
+
+class Generator
+{
+public:
+    /* 改写一个源文件，返回改写后的文本 */
+    std::string rewrite(const std::string& text)
+    {
+        std::string out;
+        std::size_t copied = 0U;
+        bool line_start = true;
+
+        for (std::size_t i = 0U; i < text.size();) {
+            const char c = text[i];
+
+            if (c == '"' || c == '\'') {
+                i = skip_quoted(text, i);
+                line_start = false;
+                continue;
+            }
+            if (const std::size_t next = skip_comment(text, i); next != i) {
+                i = next;
+                continue;
+            }
+            if (c == '\n') {
+                line_start = true;
+                ++i;
+                continue;
+            }
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                ++i;
+                continue;
+            }
+            if (c == '#' && line_start) {
+                // 跳过预处理指令（包括续行）
+                while (i < text.size() && !(text[i] == '\n' && text[i - 1] != '\\')) ++i;
+                continue;
+            }
+            line_start = false;
+
+            if (!is_ident_char(c) || (i > 0U && is_ident_char(text[i - 1]))) {
+                ++i;
+                continue;
+            }
+
+            std::size_t name_end = i;
+            while (name_end < text.size() && is_ident_char(text[name_end])) ++name_end;
+            const std::string_view name = std::string_view{text}.substr(i, name_end - i);
+
+            std::size_t end = std::string::npos;
+            std::string replacement;
+            if (name == "nva_format" || name == "nva_print") {
+                end = try_call(text, name_end, name == "nva_print", replacement);
+            }
+
+            if (end == std::string::npos) {
+                i = name_end;
+                continue;
+            }
+
+            out.append(text, copied, i - copied);
+            out += replacement;
+            copied = end;
+            i = end;
+        }
+
+        out.append(text, copied, std::string::npos);
+
+        return out;
+    }
+
+    std::string header() const
+    {
+        std::ostringstream h;
+
+        h << "/* 由 nva_specgen 生成，请勿修改 */\n\n"
+          << "#ifndef NVA_SPECGEN_H\n#define NVA_SPECGEN_H\n\n"
+          << "#include \"nva/print.h\"\n\n"
+          << "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n";
+
+        for (std::size_t n = 0U; n < sites_.size(); ++n) {
+            const CallSite& site = sites_[n];
+            h << prototype(n) << ";\n";
+
+            h << "#ifdef NVA_SPECGEN_DISABLE\n#define NVA_SPECGEN_" << n << macro_params(site) << " ";
+            if (site.is_print) {
+                h << "nva_print(" << site.format << ", ";
+            }
+            else {
+                h << "nva_format((dst), " << site.format << ", ";
+            }
+            for (std::size_t k = 0U; k < site.args.size(); ++k) {
+                h << site.args[k].ctor->name << "((a" << k << "), ";
+            }
+            h << "NVA_START" << std::string(site.args.size(), ')') << ")\n";
+
+            h << "#else\n#define NVA_SPECGEN_" << n << macro_params(site) << " " << function_name(n) << "(";
+            bool first = true;
+            if (!site.is_print) {
+                h << "(dst)";
+                first = false;
+            }
+            for (std::size_t k = 0U; k < site.args.size(); ++k) {
+                h << (first ? "" : ", ") << "(a" << k << ")";
+                first = false;
+            }
+            h << ")\n#endif\n\n";
+        }
+
+        h << "#ifdef __cplusplus\n}\n#endif\n\n#endif /* !NVA_SPECGEN_H */\n";
+
+        return h.str();
+    }
+
+    std::string source() const
+    {
+        std::ostringstream s;
+
+        s << "/* 由 nva_specgen 生成，请勿修改 */\n\n"
+          << "#include \"nva_specgen.h\"\n"
+          << "#include \"nva/string.h\"\n\n"
+          << "int nva_putchar(const char c);\n";
+
+        if (sites_.empty()) return s.str();
+
+        s << "\n";
+
+        s << "/* out 为 0 时通过 nva_putchar 输出 */\n"
+          << "static char* nva_specgenWrite(char* out, const char* text, nva_Size len)\n{\n"
+          << "    nva_Size i;\n\n"
+          << "    if (out == 0) {\n"
+          << "        for (i = 0U; i < len; ++i) {\n            nva_putchar(text[i]);\n        }\n"
+          << "        return 0;\n    }\n\n"
+          << "    for (i = 0U; i < len; ++i) {\n        out[i] = text[i];\n    }\n\n"
+          << "    return out + len;\n}\n\n";
+
+        s << "static char* nva_specgenFill(char* out, const char fill, nva_Size n)\n{\n"
+          << "    for (; n > 0U; --n) {\n        out = nva_specgenWrite(out, &fill, 1U);\n    }\n\n"
+          << "    return out;\n}\n\n";
+
+        s << "static char* nva_specgenField(char* out, const char* text, nva_Size len, const char fill, "
+             "const char align, nva_Size width)\n{\n"
+          << "    const nva_Size pad = (width > len) ? width - len : 0U;\n"
+          << "    const nva_Size left = (align == '>') ? pad : ((align == '^') ? pad / 2U : 0U);\n\n"
+          << "    out = nva_specgenFill(out, fill, left);\n"
+          << "    out = nva_specgenWrite(out, text, len);\n\n"
+          << "    return nva_specgenFill(out, fill, pad - left);\n}\n";
+
+        if (uses(Kind::SIGNED)) {
+            s << "\nstatic char* nva_specgenInt(char* out, const int value, const unsigned char base, const char fill, "
+                 "const char align, const nva_Size width)\n{\n"
+              << "    char text[sizeof(int) * 8U + 2U];\n"
+              << "    nva_NumToStringAttr attr;\n"
+              << "    unsigned int len;\n\n"
+              << "    attr.base = base;\n"
+              << "    attr.upper_case = NVA_FALSE;\n"
+              << "    (void)nva_itoa(value, text, &attr, &len);\n\n"
+              << "    return nva_specgenField(out, text, len, fill, align, width);\n}\n";
+        }
+
+        if (uses(Kind::UNSIGNED)) {
+            s << "\nstatic char* nva_specgenUint(char* out, const unsigned int value, const unsigned char base, "
+                 "const unsigned char upper_case, const char fill, const char align, const nva_Size width)\n{\n"
+              << "    char text[sizeof(int) * 8U + 1U];\n"
+              << "    nva_NumToStringAttr attr;\n"
+              << "    unsigned int len;\n\n"
+              << "    attr.base = base;\n"
+              << "    attr.upper_case = upper_case;\n"
+              << "    (void)nva_uitoa(value, text, &attr, &len);\n\n"
+              << "    return nva_specgenField(out, text, len, fill, align, width);\n}\n";
+        }
+
+        for (std::size_t n = 0U; n < sites_.size(); ++n) {
+            s << "\n" << function_body(n);
+        }
+
+        return s.str();
+    }
+
+    std::size_t specialized() const { return sites_.size(); }
+    std::size_t candidates() const { return candidates_; }
+
+private:
+    std::size_t try_call(const std::string& text, std::size_t pos, const bool is_print, std::string& replacement)
+    {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+        if (pos >= text.size() || text[pos] != '(') return std::string::npos;  // 不是调用（例如取函数地址）
+
+        ++candidates_;
+
+        std::vector<std::string> parts;
+        const std::size_t end = split_args(text, pos, parts);
+        if (end == std::string::npos || parts.size() != (is_print ? 2U : 3U)) return std::string::npos;
+
+        CallSite site;
+        site.is_print = is_print;
+        site.dst = is_print ? "" : parts[0];
+        site.format = parts[is_print ? 0 : 1];
+
+        const auto format = decode_literal(site.format);
+        if (!format || !parse_chain(parts.back(), site.args)) return std::string::npos;
+        if (site.format.find("??") != std::string::npos) return std::string::npos;  // 可能是三字符组
+
+        site.format = encode_literal(*format);  // 相邻拼接的字面量合并为一行，以便写入宏定义
+
+        for (const auto& arg : site.args) {
+            if (arg.expr.find('{') != std::string::npos) return std::string::npos;  // 宏参数中不能含有顶层花括号
+        }
+
+        const auto parsed = parse_format(*format, site.args.size());
+        if (!parsed || parsed->fields.empty()) return std::string::npos;
+        site.parsed = *parsed;
+
+        // 每个参数都必须被引用，否则交给库报告错误
+        std::set<std::size_t> used;
+        for (const auto& field : site.parsed.fields) used.insert(field.arg);
+        if (used.size() != site.args.size()) return std::string::npos;
+
+        replacement = "NVA_SPECGEN_" + std::to_string(sites_.size()) + "(";
+        bool first = true;
+        if (!is_print) {
+            replacement += site.dst;
+            first = false;
+        }
+        for (const auto& arg : site.args) {
+            replacement += (first ? "" : ", ") + arg.expr;
+            first = false;
+        }
+
+        // 保持行号不变
+        const auto newlines = static_cast<std::size_t>(std::count(text.begin() + pos, text.begin() + end, '\n'));
+        replacement += std::string(newlines, '\n') + ")";
+
+        sites_.push_back(site);
+
+        return end;
+    }
+
+    /* 是否有字段以 kind 对应的方式直接展开 */
+    bool uses(const Kind kind) const
+    {
+        for (const auto& site : sites_) {
+            for (const auto& field : site.parsed.fields) {
+                const Kind k = site.args[field.arg].ctor->kind;
+                if (k == kind && decode_direct(field.spec, k)) return true;
+            }
+        }
+        return false;
+    }
+
+    std::string function_name(const std::size_t n) const
+    {
+        return std::string{sites_[n].is_print ? "nva_specgenPrint" : "nva_specgenFormat"} + std::to_string(n);
+    }
+
+    std::string prototype(const std::size_t n) const
+    {
+        const CallSite& site = sites_[n];
+        std::string proto = "nva_ErrorCode " + function_name(n) + "(";
+        bool first = true;
+
+        if (!site.is_print) {
+            proto += "char* dst";
+            first = false;
+        }
+        for (std::size_t k = 0U; k < site.args.size(); ++k) {
+            proto += (first ? "" : ", ") + std::string{site.args[k].ctor->c_type} + " a" + std::to_string(k);
+            first = false;
+        }
+
+        return proto + (first ? "void)" : ")");
+    }
+
+    static std::string macro_params(const CallSite& site)
+    {
+        std::string params = "(";
+        bool first = true;
+
+        if (!site.is_print) {
+            params += "dst";
+            first = false;
+        }
+        for (std::size_t k = 0U; k < site.args.size(); ++k) {
+            params += (first ? "" : ", ") + std::string{"a"} + std::to_string(k);
+            first = false;
+        }
+
+        return params + ")";
+    }
+
+    static std::string fallback(const CallSite& site, const Field& field, const std::string& indent)
+    {
+        const Argument& arg = site.args[field.arg];
+        const std::string format = encode_literal("{" + (field.spec.empty() ? "" : ":" + field.spec) + "}");
+        const std::string chain = std::string{arg.ctor->name} + "(a" + std::to_string(field.arg) + ", NVA_START)";
+
+        if (site.is_print) {
+            return indent + "code = nva_print(" + format + ", " + chain + ");\n" + indent +
+                   "if (code != NVA_SUCCESS) return code;\n";
+        }
+
+        return indent + "code = nva_format(out, " + format + ", " + chain + ");\n" + indent +
+               "if (code != NVA_SUCCESS) return code;\n" + indent + "out += nva_strlen(out);\n";
+    }
+
+    std::string function_body(const std::size_t n) const
+    {
+        const CallSite& site = sites_[n];
+        std::ostringstream b;
+
+        b << "/* " << (site.is_print ? "nva_print" : "nva_format") << "(" << site.format << ", ...) */\n";
+        b << prototype(n) << "\n{\n";
+        b << "    char* out = " << (site.is_print ? "0" : "dst") << ";\n";
+        b << "    nva_ErrorCode code = NVA_SUCCESS;\n\n";
+        if (!site.is_print) {
+            b << "    if (dst == 0) return NVA_PARAM_ERROR;\n\n";
+        }
+
+        for (std::size_t f = 0U; f <= site.parsed.fields.size(); ++f) {
+            const std::string& literal = site.parsed.literals[f];
+            if (!literal.empty()) {
+                b << "    out = nva_specgenWrite(out, " << encode_literal(literal) << ", " << literal.size() << "U);\n";
+            }
+            if (f == site.parsed.fields.size()) break;
+
+            const Field& field = site.parsed.fields[f];
+            const Argument& arg = site.args[field.arg];
+            const std::string a = "a" + std::to_string(field.arg);
+            const auto direct = decode_direct(field.spec, arg.ctor->kind);
+
+            if (!direct) {
+                b << fallback(site, field, "    ");
+                continue;
+            }
+
+            const std::string tail = ", " + char_literal(direct->fill) + ", " + char_literal(direct->align) + ", " +
+                                     std::to_string(direct->width) + "U);\n";
+
+            switch (arg.ctor->kind) {
+                case Kind::SIGNED:
+                    b << "    out = nva_specgenInt(out, " << a << ", " << direct->base << "U" << tail;
+                    break;
+                case Kind::UNSIGNED:
+                    b << "    out = nva_specgenUint(out, " << a << ", " << direct->base << "U, "
+                      << (direct->upper_case ? "NVA_TRUE" : "NVA_FALSE") << tail;
+                    break;
+                case Kind::CHAR:
+                    b << "    out = nva_specgenField(out, &" << a << ", 1U" << tail;
+                    break;
+                case Kind::STRING:
+                    // 空指针的处理方式交给库决定
+                    b << "    if (" << a << " == 0) {\n"
+                      << fallback(site, field, "        ") << "    }\n"
+                      << "    else {\n"
+                      << "        out = nva_specgenField(out, " << a << ", nva_strlen(" << a << ")" << tail
+                      << "    }\n";
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        if (!site.is_print) {
+            b << "    *out = '\\0';\n";
+        }
+        b << "\n    (void)out;\n    return code;\n}\n";
+
+        return b.str();
+    }
+
+    std::vector<CallSite> sites_;
+    std::size_t candidates_ = 0U;
+};
+
+bool read_file(const std::string& path, std::string& text)
+{
+    std::ifstream in{path, std::ios::binary};
+    if (!in) return false;
+
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    text = ss.str();
+
+    return true;
+}
+
+bool write_file(const std::string& path, const std::string& text)
+{
+    std::ofstream out{path, std::ios::binary};
+    out << text;
+
+    return static_cast<bool>(out);
+}
+
+std::string base_name(const std::string& path)
+{
+    const std::size_t slash = path.find_last_of("/\\");
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+}
+
+/* #line 中的路径需要转义反斜杠 */
+std::string line_path(const std::string& path)
+{
+    std::string out;
+    for (const char c : path) {
+        if (c == '\\' || c == '"') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string out_dir;
+    std::vector<std::string> sources;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+
+        if (arg == "--out-dir" && i + 1 < argc) {
+            out_dir = argv[++i];
+        }
+        else {
+            sources.push_back(arg);
+        }
+    }
+
+    if (out_dir.empty() || sources.empty()) {
+        std::cerr << "usage: " << argv[0] << " --out-dir <dir> <source.c>...\n";
+        return EXIT_FAILURE;
+    }
+
+    Generator generator;
+    std::set<std::string> names;
+
+    for (const auto& path : sources) {
+        std::string text;
+        if (!read_file(path, text)) {
+            std::cerr << "nva_specgen: cannot read " << path << "\n";
+            return EXIT_FAILURE;
+        }
+
+        const std::string name = base_name(path);
+        if (!names.insert(name).second) {
+            std::cerr << "nva_specgen: duplicate file name " << name << "\n";
+            return EXIT_FAILURE;
+        }
+
+        const std::string rewritten =
+            "#include \"nva_specgen.h\"\n#line 1 \"" + line_path(path) + "\"\n" + generator.rewrite(text);
+        if (!write_file(out_dir + "/" + name, rewritten)) {
+            std::cerr << "nva_specgen: cannot write " << out_dir << "/" << name << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!write_file(out_dir + "/nva_specgen.h", generator.header()) ||
+        !write_file(out_dir + "/nva_specgen.c", generator.source())) {
+        std::cerr << "nva_specgen: cannot write to " << out_dir << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "nva_specgen: specialized " << generator.specialized() << " of " << generator.candidates()
+              << " nva_format/nva_print calls\n";
+
+    return EXIT_SUCCESS;
+}
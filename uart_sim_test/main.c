@@ -0,0 +1,138 @@
+/**
+ * @file main.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 串口输出吞吐测试：比较逐字节阻塞发送与双缓冲发送的 CPU 占用
+ *
+ * 用法：uart_sim_test [dma|blocking] [baud] [repeat]
+ * 发送的数据写到 stdout，统计结果写到 stderr。
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mcu_test_suits.h"
+#include "nva_tx_sink.h"
+#include "uart_sim.h"
+
+typedef enum {
+    TX_MODE_DMA = 0,
+    TX_MODE_BLOCKING,
+} TxMode;
+
+static TxMode tx_mode = TX_MODE_DMA;
+
+int nva_putchar(const char c)
+{
+    static char blocking_char;
+
+    if (tx_mode == TX_MODE_DMA) {
+        return nva_txSinkPutchar(c);
+    }
+
+    // 与 mcu_test 中 while (TI == 0) 的写法等价：每个字节都忙等到发送完成，等待时间计入 CPU 占用
+    blocking_char = c;
+    nva_uartSimStart(&blocking_char, 1U);
+    while (nva_uartSimBusy()) {
+    }
+
+    return 1;
+}
+
+void nva_txPortStart(const char* const buf, const unsigned int len)
+{
+    nva_uartSimStart(buf, len);
+}
+
+void nva_txPortWait(void)
+{
+    nva_uartSimWaitIdle();
+}
+
+static double elapsedSeconds(const clockid_t clock, const struct timespec* const begin)
+{
+    struct timespec end;
+    clock_gettime(clock, &end);
+
+    return (double)(end.tv_sec - begin->tv_sec) + (double)(end.tv_nsec - begin->tv_nsec) / 1e9;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned long baud = 115200U;
+    unsigned long repeat = 10U;
+
+    if (argc > 1) {
+        if (strcmp(argv[1], "blocking") == 0) {
+            tx_mode = TX_MODE_BLOCKING;
+        }
+        else if (strcmp(argv[1], "dma") != 0) {
+            fprintf(stderr, "usage: %s [dma|blocking] [baud] [repeat]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (argc > 2) baud = strtoul(argv[2], NULL, 10);
+    if (argc > 3) repeat = strtoul(argv[3], NULL, 10);
+
+    const nva_UartSimConfig config = {
+        .baud = baud,
+        .bits_per_frame = 10U,
+        .output = stdout,
+        .on_complete = nva_txSinkOnComplete,
+    };
+
+    if (nva_uartSimInit(&config) != 0) {
+        fprintf(stderr, "failed to start the simulated uart.\n");
+        return EXIT_FAILURE;
+    }
+
+    nva_txSinkInit();
+
+    struct timespec wall_begin;
+    struct timespec cpu_begin;
+    clock_gettime(CLOCK_MONOTONIC, &wall_begin);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_begin);
+
+    for (unsigned long i = 0U; i < repeat; ++i) {
+        nva_mcu_test_run();
+    }
+
+    const double cpu_format = elapsedSeconds(CLOCK_THREAD_CPUTIME_ID, &cpu_begin);
+    const double wall_format = elapsedSeconds(CLOCK_MONOTONIC, &wall_begin);
+
+    nva_txSinkDrain();
+
+    const double cpu_total = elapsedSeconds(CLOCK_THREAD_CPUTIME_ID, &cpu_begin);
+    const double wall_total = elapsedSeconds(CLOCK_MONOTONIC, &wall_begin);
+
+    nva_uartSimDeinit();
+    fflush(stdout);
+
+    const double wire = nva_uartSimWireSeconds();
+
+    fprintf(stderr, "\n");
+    fprintf(stderr, "mode            : %s", (tx_mode == TX_MODE_DMA) ? "dma" : "blocking");
+    if (tx_mode == TX_MODE_DMA) fprintf(stderr, " (2 x %d bytes)", NVA_TX_SINK_HALF_SIZE);
+    fprintf(stderr, "\n");
+    if (tx_mode == TX_MODE_DMA) {
+        fprintf(stderr, "buffer peak     : %u / %d bytes, %u stalls\n",
+                nva_txSinkPeak(),
+                2 * NVA_TX_SINK_HALF_SIZE,
+                nva_txSinkStalls());
+    }
+    fprintf(stderr, "baud            : %lu (%u bits/frame)\n", baud, config.bits_per_frame);
+    fprintf(stderr, "bytes           : %llu in %llu transfers\n", nva_uartSimBytes(), nva_uartSimTransfers());
+    fprintf(stderr, "wire time       : %10.3f ms\n", wire * 1e3);
+    fprintf(stderr, "wall time       : %10.3f ms (formatter returned after %.3f ms)\n",
+            wall_total * 1e3,
+            wall_format * 1e3);
+    fprintf(stderr, "cpu busy time   : %10.3f ms (%.2f%% of wire time)\n", cpu_total * 1e3, cpu_total / wire * 1e2);
+    fprintf(stderr, "cpu in format   : %10.3f ms\n", cpu_format * 1e3);
+    fprintf(stderr, "format stalled  : %10.3f ms (waiting for the uart)\n", (wall_format - cpu_format) * 1e3);
+
+    return EXIT_SUCCESS;
+}
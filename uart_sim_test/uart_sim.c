@@ -0,0 +1,200 @@
+/**
+ * @file uart_sim.c
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 在 Linux 主机上模拟带 DMA 的串口外设
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "uart_sim.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define NS_PER_SEC 1000000000LL
+
+static struct {
+    nva_UartSimConfig config;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+
+    const char* buf;
+    unsigned int len;
+    bool active;
+    bool quit;
+    atomic_bool busy;  // 与 active 相同，供 nva_uartSimBusy 不加锁地轮询
+
+    long long line_free_ns;  // 线路空闲的时刻，用于连续发送时不累积定时误差
+    unsigned long long bytes;
+    unsigned long long transfers;
+    long long wire_ns;
+} sim;
+
+static long long nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+static void sleepUntilNs(const long long deadline)
+{
+    struct timespec ts;
+    ts.tv_sec = deadline / NS_PER_SEC;
+    ts.tv_nsec = deadline % NS_PER_SEC;
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+static void* uartSimThread(void* arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&sim.mutex);
+
+    for (;;) {
+        while (!sim.quit && (!sim.active || sim.buf == NULL)) {
+            pthread_cond_wait(&sim.cond, &sim.mutex);
+        }
+        if (sim.quit) break;
+
+        const char* const buf = sim.buf;
+        const unsigned int len = sim.len;
+        pthread_mutex_unlock(&sim.mutex);
+
+        const long long duration =
+            (long long)len * sim.config.bits_per_frame * NS_PER_SEC / (long long)sim.config.baud;
+        const long long now = nowNs();
+        const long long start = (sim.line_free_ns > now) ? sim.line_free_ns : now;
+        sim.line_free_ns = start + duration;
+
+        sleepUntilNs(sim.line_free_ns);
+
+        if (sim.config.output != NULL) {
+            fwrite(buf, 1U, len, sim.config.output);
+        }
+
+        pthread_mutex_lock(&sim.mutex);
+        sim.bytes += len;
+        sim.transfers += 1U;
+        sim.wire_ns += duration;
+        sim.buf = NULL;
+        sim.active = false;
+        atomic_store(&sim.busy, false);
+
+        if (sim.config.on_complete != NULL) {
+            sim.config.on_complete();
+        }
+
+        pthread_cond_broadcast(&sim.cond);
+    }
+
+    pthread_mutex_unlock(&sim.mutex);
+
+    return NULL;
+}
+
+int nva_uartSimInit(const nva_UartSimConfig* const config)
+{
+    if (config == NULL || config->baud == 0U || config->bits_per_frame == 0U) {
+        return -1;
+    }
+
+    sim.config = *config;
+    sim.buf = NULL;
+    sim.len = 0U;
+    sim.active = false;
+    sim.quit = false;
+    atomic_init(&sim.busy, false);
+    sim.line_free_ns = 0;
+    sim.bytes = 0U;
+    sim.transfers = 0U;
+    sim.wire_ns = 0;
+
+    pthread_mutex_init(&sim.mutex, NULL);
+    pthread_cond_init(&sim.cond, NULL);
+
+    return pthread_create(&sim.thread, NULL, uartSimThread, NULL);
+}
+
+void nva_uartSimDeinit(void)
+{
+    nva_uartSimWaitIdle();
+
+    pthread_mutex_lock(&sim.mutex);
+    sim.quit = true;
+    pthread_cond_broadcast(&sim.cond);
+    pthread_mutex_unlock(&sim.mutex);
+
+    pthread_join(sim.thread, NULL);
+
+    pthread_cond_destroy(&sim.cond);
+    pthread_mutex_destroy(&sim.mutex);
+}
+
+void nva_uartSimStart(const char* const buf, const unsigned int len)
+{
+    pthread_mutex_lock(&sim.mutex);
+
+    while (sim.active) {
+        pthread_cond_wait(&sim.cond, &sim.mutex);
+    }
+
+    sim.buf = buf;
+    sim.len = len;
+    sim.active = true;
+    atomic_store(&sim.busy, true);
+    pthread_cond_broadcast(&sim.cond);
+
+    pthread_mutex_unlock(&sim.mutex);
+}
+
+void nva_uartSimWaitIdle(void)
+{
+    pthread_mutex_lock(&sim.mutex);
+
+    while (sim.active) {
+        pthread_cond_wait(&sim.cond, &sim.mutex);
+    }
+
+    pthread_mutex_unlock(&sim.mutex);
+}
+
+int nva_uartSimBusy(void)
+{
+    return atomic_load(&sim.busy);
+}
+
+unsigned long long nva_uartSimBytes(void)
+{
+    pthread_mutex_lock(&sim.mutex);
+    const unsigned long long bytes = sim.bytes;
+    pthread_mutex_unlock(&sim.mutex);
+
+    return bytes;
+}
+
+unsigned long long nva_uartSimTransfers(void)
+{
+    pthread_mutex_lock(&sim.mutex);
+    const unsigned long long transfers = sim.transfers;
+    pthread_mutex_unlock(&sim.mutex);
+
+    return transfers;
+}
+
+double nva_uartSimWireSeconds(void)
+{
+    pthread_mutex_lock(&sim.mutex);
+    const long long wire_ns = sim.wire_ns;
+    pthread_mutex_unlock(&sim.mutex);
+
+    return (double)wire_ns / (double)NS_PER_SEC;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file uart_sim.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 在 Linux 主机上模拟带 DMA 的串口外设
+ *
+ * 由一个定时线程按波特率模拟线上传输时间，传输结束后调用 on_complete，相当于发送完成中断。
+ */
+
+#ifndef NVA_UART_SIM_H
+#define NVA_UART_SIM_H
+
+#include <stdio.h>
+
+typedef struct {
+    unsigned long baud;
+    unsigned int bits_per_frame;  // 起始位 + 数据位 + 校验位 + 停止位
+    FILE* output;                 // 模拟的线路另一端，为 NULL 时丢弃数据
+    void (*on_complete)(void);    // 发送完成“中断”，在定时线程中调用
+} nva_UartSimConfig;
+
+int nva_uartSimInit(const nva_UartSimConfig* config);
+
+void nva_uartSimDeinit(void);
+
+/* 启动一次发送，外设忙时调用属于使用错误 */
+void nva_uartSimStart(const char* buf, unsigned int len);
+
+/* 阻塞（不占用 CPU）直到外设空闲 */
+void nva_uartSimWaitIdle(void);
+
+/* 外设是否正在发送，相当于读取 TI 标志，可以在循环中轮询 */
+int nva_uartSimBusy(void);
+
+unsigned long long nva_uartSimBytes(void);
+
+unsigned long long nva_uartSimTransfers(void);
+
+/* 已发送字节在线路上占用的时间，单位为秒 */
+double nva_uartSimWireSeconds(void);
+
+#endif /* !NVA_UART_SIM_H */
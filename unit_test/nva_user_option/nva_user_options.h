@@ -17,4 +17,45 @@
 
 #define NVA_STACK_DEFAULT_SIZE 64
 
+#ifdef NVA_ENABLE_STATS
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 统计与钩子接入测试中的计数函数，见 test_suits/stats_test.cpp。
+ * 只有 nva_print 提供 nva/stats.h 时 unit_test_stats 才会定义 NVA_ENABLE_STATS */
+unsigned long nva_testStatsClock(void);
+void nva_testHookFormatBegin(const char* format);
+void nva_testHookFormatEnd(const char* format, int code);
+void nva_testHookField(unsigned char type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define NVA_STATS_CLOCK()                   nva_testStatsClock()
+#define NVA_HOOK_FORMAT_BEGIN(format)       nva_testHookFormatBegin(format)
+#define NVA_HOOK_FORMAT_END(format, code)   nva_testHookFormatEnd((format), (code))
+#define NVA_HOOK_FIELD(type)                nva_testHookField(type)
+#endif
+
+#ifdef NVA_TEST_CODE_SPACE
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 统计经由 NVA_CODE_READ_BYTE 读取的字节，见 test_suits/code_space_test.cpp。
+ * 只有 nva_print 支持代码空间格式字符串时 unit_test_code_space 才会定义 NVA_TEST_CODE_SPACE */
+char nva_testCodeReadByte(const char* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* 主机上代码空间就是普通内存，限定符为空 */
+#define NVA_CODE_SPACE
+#define NVA_CODE
+#define NVA_CODE_READ_BYTE(p)               nva_testCodeReadByte((const char*)(p))
+#endif
+
 #endif  // !NVA_NVA_USER_OPTIONS_H
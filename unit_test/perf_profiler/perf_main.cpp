@@ -0,0 +1,88 @@
+/**
+ * @file perf_main.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 格式化引擎的逐调用硬件计数统计
+ *
+ * 用法：nva_perf_profile [repeat]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "nva/print.h"
+#include "perf_profiler.h"
+
+static std::size_t putchar_count;
+
+extern "C" int nva_putchar(const char c)
+{
+    (void)c;
+    ++putchar_count;
+
+    return 1;
+}
+
+std::size_t nva_perf::putcharCount()
+{
+    return putchar_count;
+}
+
+void nva_perf::putcharReset()
+{
+    putchar_count = 0U;
+}
+
+static void run_once(nva_perf::Profiler& profiler, const unsigned int i)
+{
+    static char dst[256];
+    const int value = static_cast<int>(i * 2654435761U);
+
+    // 空调用，作为计数器自身的开销基准
+    profiler.measureBaseline();
+
+    NVA_PERF_FORMAT(profiler, "literal", dst, "Hello, World!", NVA_START);
+    NVA_PERF_FORMAT(profiler, "{} int", dst, "{}", nva_int(value, NVA_START));
+    NVA_PERF_FORMAT(profiler, "{:08x} uint", dst, "{:08x}", nva_uint(static_cast<unsigned int>(value), NVA_START));
+    NVA_PERF_FORMAT(profiler, "{:#b} uint", dst, "{:#b}", nva_uint(i & 0xFFFFU, NVA_START));
+    NVA_PERF_FORMAT(profiler, "{:*^20} str", dst, "{:*^20}", nva_str("centered", NVA_START));
+    NVA_PERF_FORMAT(profiler, "{:.3f} double", dst, "{:.3f}", nva_double(value / 1000.0, NVA_START));
+    NVA_PERF_FORMAT(profiler, "{} ptr", dst, "{}", nva_ptr(dst, NVA_START));
+    NVA_PERF_FORMAT(profiler,
+                    "positional int/char/str",
+                    dst,
+                    "{2} {0} {1}",
+                    nva_int(1, nva_char('c', nva_str("three", NVA_START))));
+    NVA_PERF_FORMAT(profiler,
+                    "log line",
+                    dst,
+                    "[{}] {}: id={:>6} t={:.2f}",
+                    nva_str("INFO", nva_str("sensor", nva_int(value & 0xFFFF, nva_double(i * 0.25, NVA_START)))));
+
+    NVA_PERF_PRINT(profiler, "print {} int", "{}\n", nva_int(value, NVA_START));
+    NVA_PERF_PRINT(profiler,
+                   "print log line",
+                   "[{}] {}: id={:>6}\n",
+                   nva_str("INFO", nva_str("sensor", nva_int(value, NVA_START))));
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned long repeat = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10000U;
+
+    nva_perf::CounterGroup group;
+    if (!group.valid()) {
+        std::fprintf(stderr, "%s\n", group.error().c_str());
+        return EXIT_FAILURE;
+    }
+
+    nva_perf::Profiler profiler{group};
+
+    for (unsigned long i = 0U; i < repeat; ++i) {
+        run_once(profiler, static_cast<unsigned int>(i));
+    }
+
+    profiler.report(stdout);
+
+    return EXIT_SUCCESS;
+}
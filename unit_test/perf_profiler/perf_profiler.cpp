@@ -0,0 +1,172 @@
+/**
+ * @file perf_profiler.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 基于 perf_event_open 的逐调用性能计数（仅 Linux）
+ */
+
+#include "perf_profiler.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <vector>
+
+namespace nva_perf {
+
+namespace {
+
+struct CounterInfo {
+    const char* name;
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr CounterInfo counter_info[COUNTER_NUM] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"L1-dcache-load-misses",
+     PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U)},
+};
+
+int open_counter(const CounterInfo& info, const int group_fd)
+{
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = info.type;
+    attr.config = info.config;
+    attr.disabled = (group_fd < 0) ? 1U : 0U;  // 只有组长需要显式开启
+    attr.exclude_kernel = 1U;
+    attr.exclude_hv = 1U;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0UL));
+}
+
+double per(const std::uint64_t total, const std::uint64_t count)
+{
+    return (count == 0U) ? 0.0 : static_cast<double>(total) / static_cast<double>(count);
+}
+
+}  // namespace
+
+CounterGroup::CounterGroup()
+{
+    std::fill(std::begin(fds_), std::end(fds_), -1);
+
+    fds_[CYCLES] = open_counter(counter_info[CYCLES], -1);
+    if (fds_[CYCLES] < 0) {
+        error_ = std::string{"perf_event_open(cycles): "} + std::strerror(errno) +
+                 " (check /proc/sys/kernel/perf_event_paranoid, or whether the host exposes a PMU)";
+        return;
+    }
+
+    // 其余计数器打不开时（例如虚拟机没有提供）只是不统计该项
+    for (std::size_t i = INSTRUCTIONS; i < COUNTER_NUM; ++i) {
+        fds_[i] = open_counter(counter_info[i], fds_[CYCLES]);
+    }
+}
+
+CounterGroup::~CounterGroup()
+{
+    for (const int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+void CounterGroup::start()
+{
+    ioctl(fds_[CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds_[CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+Sample CounterGroup::stop()
+{
+    ioctl(fds_[CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    Sample sample{};
+    for (std::size_t i = 0U; i < COUNTER_NUM; ++i) {
+        if (fds_[i] < 0 || read(fds_[i], &sample.value[i], sizeof(sample.value[i])) != sizeof(sample.value[i])) {
+            sample.value[i] = 0U;
+        }
+    }
+
+    return sample;
+}
+
+void Profiler::add(Record& rec, const nva_ErrorCode code, const std::size_t bytes, const Sample& sample)
+{
+    ++rec.calls;
+    rec.bytes += bytes;
+    if (code != NVA_SUCCESS) ++rec.failures;
+
+    for (std::size_t i = 0U; i < COUNTER_NUM; ++i) {
+        rec.total.value[i] += sample.value[i];
+    }
+}
+
+double Profiler::net(const Record& rec, const Counter counter) const
+{
+    const double base = per(baseline_.total.value[counter], baseline_.calls);
+
+    return std::max(per(rec.total.value[counter], rec.calls) - base, 0.0);
+}
+
+void Profiler::report(std::FILE* const out) const
+{
+    // 按每字节指令数从高到低排列，开销最大的格式说明符排在最前
+    std::vector<std::pair<const std::string*, const Record*>> rows;
+    for (const auto& [label, rec] : records_) {
+        rows.emplace_back(&label, &rec);
+    }
+    std::sort(rows.begin(), rows.end(), [this](const auto& a, const auto& b) {
+        return net(*a.second, INSTRUCTIONS) / std::max(per(a.second->bytes, a.second->calls), 1.0) >
+               net(*b.second, INSTRUCTIONS) / std::max(per(b.second->bytes, b.second->calls), 1.0);
+    });
+
+    std::fprintf(out,
+                 "%-36s %8s %8s %10s %10s %8s %8s %10s %10s\n",
+                 "label",
+                 "calls",
+                 "bytes",
+                 "cycles",
+                 "instr",
+                 "IPC",
+                 "instr/B",
+                 "br-miss",
+                 "L1d-miss");
+
+    for (const auto& [label, rec] : rows) {
+        const double bytes = per(rec->bytes, rec->calls);
+        const double cycles = net(*rec, CYCLES);
+        const double instructions = net(*rec, INSTRUCTIONS);
+
+        std::fprintf(out,
+                     "%-36.36s %8llu %8.1f %10.1f %10.1f %8.2f %8.1f %10.2f %10.2f%s\n",
+                     label->c_str(),
+                     static_cast<unsigned long long>(rec->calls),
+                     bytes,
+                     cycles,
+                     instructions,
+                     (cycles > 0.0) ? instructions / cycles : 0.0,
+                     (bytes > 0.0) ? instructions / bytes : 0.0,
+                     net(*rec, BRANCH_MISSES),
+                     net(*rec, L1D_MISSES),
+                     (rec->failures != 0U) ? "  (failed)" : "");
+    }
+
+    const Sample& base = baseline_.total;
+    std::fprintf(out,
+                 "\ncolumns other than calls are averages per call, except IPC and instr/B.\n"
+                 "counts are net of the empty-call baseline (%.1f cycles, %.1f instr per call, %llu samples).\n",
+                 per(base.value[CYCLES], baseline_.calls),
+                 per(base.value[INSTRUCTIONS], baseline_.calls),
+                 static_cast<unsigned long long>(baseline_.calls));
+}
+
+}  // namespace nva_perf
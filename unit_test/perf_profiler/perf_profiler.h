@@ -0,0 +1,134 @@
+/**
+ * @file perf_profiler.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 基于 perf_event_open 的逐调用性能计数（仅 Linux）
+ *
+ * 用 NVA_PERF_FORMAT / NVA_PERF_PRINT 包裹 nva_format / nva_print 调用，
+ * 按调用者给出的标签汇总周期数、指令数、分支预测失败与 L1 数据缓存未命中。
+ * 报告中的计数都减去了空调用（计数器自身开销）的平均值。
+ */
+
+#pragma once
+#ifndef NVA_PERF_PROFILER_H
+#define NVA_PERF_PROFILER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include "nva/print.h"
+
+namespace nva_perf {
+
+enum Counter : std::size_t {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    BRANCH_MISSES,
+    L1D_MISSES,
+    COUNTER_NUM,
+};
+
+struct Sample {
+    std::uint64_t value[COUNTER_NUM];
+};
+
+/* 以一个事件组打开全部计数器，保证它们在同一时间段内计数 */
+class CounterGroup
+{
+public:
+    CounterGroup();
+    ~CounterGroup();
+
+    CounterGroup(const CounterGroup&) = delete;
+    CounterGroup& operator=(const CounterGroup&) = delete;
+
+    /* 打开失败时（内核不支持或 perf_event_paranoid 限制）返回 false，error() 给出原因 */
+    bool valid() const { return fds_[CYCLES] >= 0; }
+    const std::string& error() const { return error_; }
+
+    void start();
+    Sample stop();
+
+private:
+    int fds_[COUNTER_NUM];
+    std::string error_;
+};
+
+/* perf_main.cpp 中的 nva_putchar 输出的字节数 */
+std::size_t putcharCount();
+void putcharReset();
+
+class Profiler
+{
+public:
+    explicit Profiler(CounterGroup& group) : group_{group} {}
+
+    /* 测量一次空调用，作为计数器自身开销的基准 */
+    void measureBaseline()
+    {
+        group_.start();
+        const Sample sample = group_.stop();
+
+        add(baseline_, NVA_SUCCESS, 0U, sample);
+    }
+
+    /* 测量一次 nva_format 调用，call 中构造参数链的开销也计算在内 */
+    template<typename Call>
+    nva_ErrorCode measureFormat(const char* const label, const char* const dst, Call&& call)
+    {
+        group_.start();
+        const nva_ErrorCode code = call();
+        const Sample sample = group_.stop();
+
+        add(records_[label], code, std::strlen(dst), sample);
+        return code;
+    }
+
+    /* 测量一次 nva_print 调用，输出字节数由 nva_putchar 统计 */
+    template<typename Call>
+    nva_ErrorCode measurePrint(const char* const label, Call&& call)
+    {
+        putcharReset();
+
+        group_.start();
+        const nva_ErrorCode code = call();
+        const Sample sample = group_.stop();
+
+        add(records_[label], code, putcharCount(), sample);
+        return code;
+    }
+
+    /* 输出每个标签减去基准之后的平均开销与每输出字节的指令数 */
+    void report(std::FILE* out) const;
+
+private:
+    struct Record {
+        std::uint64_t calls;
+        std::uint64_t bytes;
+        std::uint64_t failures;
+        Sample total;
+    };
+
+    static void add(Record& rec, nva_ErrorCode code, std::size_t bytes, const Sample& sample);
+
+    /* 每次调用的平均计数减去基准的平均计数，不小于 0 */
+    double net(const Record& rec, Counter counter) const;
+
+    CounterGroup& group_;
+    Record baseline_{};
+    std::map<std::string, Record> records_;
+};
+
+}  // namespace nva_perf
+
+/* label 区分不同的用例；格式字符串相同、参数类型不同的调用应使用不同的标签 */
+#define NVA_PERF_FORMAT(profiler, label, dst, format, status) \
+    (profiler).measureFormat((label), (dst), [&]() { return nva_format((dst), (format), (status)); })
+
+#define NVA_PERF_PRINT(profiler, label, format, status) \
+    (profiler).measurePrint((label), [&]() { return nva_print((format), (status)); })
+
+#endif  // !NVA_PERF_PROFILER_H
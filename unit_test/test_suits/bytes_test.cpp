@@ -0,0 +1,473 @@
+/**
+ * @file bytes_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 字节块参数 nva_bytes 的十六进制、hexdump 与 base64 输出测试
+ *
+ * nva_bytes 由 nva_print 提供，仅在配置时探测到后测试（UNIT_TEST_HAS_BYTES）；
+ * nva_ext 的 nva_hexEncode、nva_hexdump 与 nva_base64Encode 总是测试。
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/ext/bytes.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*----------------------------------------------------------*/
+/* 参考实现：逐字节编码                                        */
+static std::string ref_hex(const uint8_t* data, const std::size_t len, const bool upper)
+{
+    const char* const digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string out;
+
+    for (std::size_t i = 0U; i < len; ++i) {
+        out += digits[data[i] >> 4U];
+        out += digits[data[i] & 0x0FU];
+    }
+
+    return out;
+}
+
+/* 与 hexdump -C 相同的行格式，但不输出最后的总长度行 */
+static std::string ref_hexdump(const uint8_t* data, const std::size_t len)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+
+    for (std::size_t offset = 0U; offset < len; offset += 16U) {
+        const std::size_t n = (len - offset < 16U) ? len - offset : 16U;
+
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            out += digits[(offset >> shift) & 0x0FU];
+        }
+        out += "  ";
+
+        for (std::size_t i = 0U; i < 16U; ++i) {
+            if (i < n) {
+                out += digits[data[offset + i] >> 4U];
+                out += digits[data[offset + i] & 0x0FU];
+                out += ' ';
+            }
+            else {
+                out += "   ";
+            }
+            if (i == 7U) out += ' ';
+        }
+
+        out += " |";
+        for (std::size_t i = 0U; i < n; ++i) {
+            const uint8_t c = data[offset + i];
+            out += (c >= 0x20U && c < 0x7FU) ? static_cast<char>(c) : '.';
+        }
+        out += "|\n";
+    }
+
+    return out;
+}
+
+/* RFC 4648 标准字母表，带 '=' 填充 */
+static std::string ref_base64(const uint8_t* data, const std::size_t len)
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    std::size_t i = 0U;
+
+    for (; i + 3U <= len; i += 3U) {
+        const uint32_t v = (data[i] << 16U) | (data[i + 1U] << 8U) | data[i + 2U];
+        out += alphabet[(v >> 18U) & 0x3FU];
+        out += alphabet[(v >> 12U) & 0x3FU];
+        out += alphabet[(v >> 6U) & 0x3FU];
+        out += alphabet[v & 0x3FU];
+    }
+
+    if (len - i == 1U) {
+        const uint32_t v = data[i] << 16U;
+        out += alphabet[(v >> 18U) & 0x3FU];
+        out += alphabet[(v >> 12U) & 0x3FU];
+        out += "==";
+    }
+    else if (len - i == 2U) {
+        const uint32_t v = (data[i] << 16U) | (data[i + 1U] << 8U);
+        out += alphabet[(v >> 18U) & 0x3FU];
+        out += alphabet[(v >> 12U) & 0x3FU];
+        out += alphabet[(v >> 6U) & 0x3FU];
+        out += '=';
+    }
+
+    return out;
+}
+
+/* 以太网帧大小的伪随机数据 */
+static std::vector<uint8_t> make_frame(const std::size_t len)
+{
+    std::vector<uint8_t> frame(len);
+    uint32_t seed = 0x12345678U;
+
+    for (auto& byte : frame) {
+        seed = seed * 1103515245U + 12345U;
+        byte = static_cast<uint8_t>(seed >> 16U);
+    }
+
+    return frame;
+}
+
+#ifdef UNIT_TEST_HAS_BYTES
+#define NVA_TEST_FMT(dst, format, status, expect)                      \
+    do {                                                               \
+        EXPECT_EQ(nva_format((dst), (format), (status)), NVA_SUCCESS); \
+        EXPECT_STREQ((dst), (expect));                                 \
+    } while (0)
+
+/*----------------------------------------------------------*/
+/* {:x} / {:X}：连续的十六进制，没有分隔符                       */
+TEST(BytesHexTest, Basic)
+{
+    char dst[128] = {0};
+    const uint8_t packet[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01, 0x7F, 0x80};
+
+    NVA_TEST_FMT(dst, "{:x}", nva_bytes(packet, sizeof(packet), NVA_START), "deadbeef00017f80");
+    NVA_TEST_FMT(dst, "{:X}", nva_bytes(packet, sizeof(packet), NVA_START), "DEADBEEF00017F80");
+    NVA_TEST_FMT(dst, "{}", nva_bytes(packet, sizeof(packet), NVA_START), "deadbeef00017f80");  // 默认小写
+    NVA_TEST_FMT(dst, "[{:x}]", nva_bytes(packet, 1U, NVA_START), "[de]");
+    NVA_TEST_FMT(dst, "[{:x}]", nva_bytes(packet, 0U, NVA_START), "[]");
+    NVA_TEST_FMT(dst, "[{:x}]", nva_bytes(nullptr, 0U, NVA_START), "[]");
+
+    // 与其他参数混用
+    NVA_TEST_FMT(dst, "len={} data={:X}!", nva_uint(4U, nva_bytes(packet, 4U, NVA_START)), "len=4 data=DEADBEEF!");
+}
+
+/* 16/32 字节一组编码，覆盖所有起始对齐与尾部长度 */
+TEST(BytesHexTest, EveryAlignmentAndLength)
+{
+    const std::vector<uint8_t> frame = make_frame(64U + 130U);
+    std::vector<char> dst(2U * 130U + 1U);
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t len = 0U; len <= 130U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(nva_format(dst.data(), "{:x}", nva_bytes(data, len, NVA_START)), NVA_SUCCESS);
+            ASSERT_EQ(std::string(dst.data()), ref_hex(data, len, false)) << "align = " << align << ", len = " << len;
+            ASSERT_EQ(nva_format(dst.data(), "{:X}", nva_bytes(data, len, NVA_START)), NVA_SUCCESS);
+            ASSERT_EQ(std::string(dst.data()), ref_hex(data, len, true)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+TEST(BytesHexTest, AllBytes)
+{
+    char dst[2 * 256 + 1] = {0};
+    uint8_t bytes[256];
+
+    for (int i = 0; i < 256; ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    ASSERT_EQ(nva_format(dst, "{:x}", nva_bytes(bytes, sizeof(bytes), NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(std::string(dst), ref_hex(bytes, sizeof(bytes), false));
+    ASSERT_EQ(nva_format(dst, "{:X}", nva_bytes(bytes, sizeof(bytes), NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(std::string(dst), ref_hex(bytes, sizeof(bytes), true));
+}
+
+/* 一次调用的结果与逐字节 {:02x} 拼接相同 */
+TEST(BytesHexTest, SameAsPerByteLoop)
+{
+    const std::vector<uint8_t> frame = make_frame(1500U);
+    std::vector<char> dst(2U * frame.size() + 1U);
+    std::string loop;
+    char byte[4] = {0};
+
+    for (const uint8_t c : frame) {
+        ASSERT_EQ(nva_format(byte, "{:02x}", nva_uchar(c, NVA_START)), NVA_SUCCESS);
+        loop += byte;
+    }
+
+    ASSERT_EQ(nva_format(dst.data(), "{:x}", nva_bytes(frame.data(), frame.size(), NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(std::string(dst.data()), loop);
+}
+
+/*----------------------------------------------------------*/
+/* {:hexdump}：偏移 + 十六进制 + ASCII 三栏，每行 16 字节          */
+TEST(BytesHexdumpTest, Basic)
+{
+    char dst[512] = {0};
+    const char text[] = "Hello, World!\n\x00\x01\x7F\x80" "abc";
+
+    NVA_TEST_FMT(dst, "{:hexdump}", nva_bytes(text, sizeof(text) - 1U, NVA_START),
+                 "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a 00 01  |Hello, World!...|\n"
+                 "00000010  7f 80 61 62 63                                    |..abc|\n");
+
+    NVA_TEST_FMT(dst, "{:hexdump}", nva_bytes(text, 16U, NVA_START),
+                 "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a 00 01  |Hello, World!...|\n");
+
+    NVA_TEST_FMT(dst, "[{:hexdump}]", nva_bytes(text, 0U, NVA_START), "[]");
+}
+
+TEST(BytesHexdumpTest, EveryLength)
+{
+    const std::vector<uint8_t> frame = make_frame(3U + 100U);
+    std::vector<char> dst(8192U);
+
+    for (std::size_t align = 0U; align < 4U; ++align) {
+        for (std::size_t len = 0U; len <= 100U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(nva_format(dst.data(), "{:hexdump}", nva_bytes(data, len, NVA_START)), NVA_SUCCESS);
+            ASSERT_EQ(std::string(dst.data()), ref_hexdump(data, len)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+/* 一个完整的以太网帧，一次调用输出 */
+TEST(BytesHexdumpTest, Frame1500)
+{
+    const std::vector<uint8_t> frame = make_frame(1500U);
+    std::vector<char> dst(8192U);
+
+    ASSERT_EQ(nva_format(dst.data(), "{:hexdump}", nva_bytes(frame.data(), frame.size(), NVA_START)), NVA_SUCCESS);
+    const std::string dump(dst.data());
+    EXPECT_EQ(dump, ref_hexdump(frame.data(), frame.size()));
+    EXPECT_EQ(dump.find("000005d0  "), 93U * 79U);  // 最后一行的偏移
+}
+
+/*----------------------------------------------------------*/
+/* {:b64}：RFC 4648 标准字母表，带填充                           */
+TEST(BytesBase64Test, Rfc4648Vectors)
+{
+    char dst[64] = {0};
+    const char* const foobar = "foobar";
+
+    NVA_TEST_FMT(dst, "[{:b64}]", nva_bytes(foobar, 0U, NVA_START), "[]");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 1U, NVA_START), "Zg==");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 2U, NVA_START), "Zm8=");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 3U, NVA_START), "Zm9v");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 4U, NVA_START), "Zm9vYg==");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 5U, NVA_START), "Zm9vYmE=");
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(foobar, 6U, NVA_START), "Zm9vYmFy");
+
+    // 字母表两端的 '+' 与 '/'
+    const uint8_t high[] = {0xFB, 0xFF, 0xBF};
+    NVA_TEST_FMT(dst, "{:b64}", nva_bytes(high, sizeof(high), NVA_START), "+/+/");
+}
+
+/* 每步 12/24 字节输入，覆盖所有起始对齐与尾部长度 */
+TEST(BytesBase64Test, EveryAlignmentAndLength)
+{
+    const std::vector<uint8_t> frame = make_frame(64U + 130U);
+    std::vector<char> dst(4U * 130U / 3U + 5U);
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t len = 0U; len <= 130U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(nva_format(dst.data(), "{:b64}", nva_bytes(data, len, NVA_START)), NVA_SUCCESS);
+            ASSERT_EQ(std::string(dst.data()), ref_base64(data, len)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+TEST(BytesBase64Test, Frame1500)
+{
+    const std::vector<uint8_t> frame = make_frame(1500U);
+    std::vector<char> dst(2048U);
+
+    ASSERT_EQ(nva_format(dst.data(), "{:b64}", nva_bytes(frame.data(), frame.size(), NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(std::string(dst.data()), ref_base64(frame.data(), frame.size()));
+    EXPECT_EQ(std::string(dst.data()).size(), 2000U);
+}
+
+/*----------------------------------------------------------*/
+/* 类型与格式不匹配                                             */
+TEST(BytesTest, Errors)
+{
+    char dst[64] = {0};
+    const uint8_t packet[] = {0x01, 0x02};
+
+    EXPECT_EQ(nva_format(dst, "{:d}", nva_bytes(packet, sizeof(packet), NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{:.3f}", nva_bytes(packet, sizeof(packet), NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{:hex}", nva_bytes(packet, sizeof(packet), NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{:b64}", nva_int(1, NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{:hexdump}", nva_str("ab", NVA_START)), NVA_FAIL);
+
+    // 长度不为 0 时不能是空指针
+    EXPECT_EQ(nva_format(dst, "{:x}", nva_bytes(nullptr, 2U, NVA_START)), NVA_FAIL);
+
+    // 失败之后参数栈被清空，后续调用不受影响
+    NVA_TEST_FMT(dst, "{:x}", nva_bytes(packet, sizeof(packet), NVA_START), "0102");
+
+    // 整数的 {:x} 不受影响
+    NVA_TEST_FMT(dst, "{:x}", nva_int(0xBEEF, NVA_START), "beef");
+}
+#endif /* UNIT_TEST_HAS_BYTES */
+
+/*----------------------------------------------------------*/
+/* nva_ext：一次调用编码整个字节块                              */
+
+/* 按大小宏分配 dst，末尾多一个哨兵字节，检查写入不越界；hexdump 的最后一行可能短于大小宏给出的上限 */
+template<typename Encode>
+static std::string ext_encode(const std::size_t size, Encode encode)
+{
+    std::vector<char> dst(size + 1U, '#');
+    const nva_Size len = encode(dst.data());
+
+    EXPECT_LE(len + 1U, size);
+    EXPECT_EQ(dst[len], '\0');
+    EXPECT_EQ(dst[size], '#');
+    return std::string(dst.data(), len);
+}
+
+static std::string ext_hex(const uint8_t* data, const std::size_t len, const bool upper)
+{
+    return ext_encode(NVA_HEX_SIZE(len), [&](char* dst) { return nva_hexEncode(dst, data, len, upper); });
+}
+
+static std::string ext_hexdump(const uint8_t* data, const std::size_t len)
+{
+    return ext_encode(NVA_HEXDUMP_SIZE(len), [&](char* dst) { return nva_hexdump(dst, data, len); });
+}
+
+static std::string ext_base64(const uint8_t* data, const std::size_t len)
+{
+    return ext_encode(NVA_BASE64_SIZE(len), [&](char* dst) { return nva_base64Encode(dst, data, len); });
+}
+
+TEST(BytesHexExtTest, Basic)
+{
+    const uint8_t packet[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01, 0x7F, 0x80};
+
+    EXPECT_EQ(ext_hex(packet, sizeof(packet), false), "deadbeef00017f80");
+    EXPECT_EQ(ext_hex(packet, sizeof(packet), true), "DEADBEEF00017F80");
+    EXPECT_EQ(ext_hex(packet, 1U, false), "de");
+    EXPECT_EQ(ext_hex(packet, 0U, false), "");
+    EXPECT_EQ(ext_hex(nullptr, 0U, false), "");
+}
+
+/* 16 字节一组编码，覆盖所有起始对齐与尾部长度 */
+TEST(BytesHexExtTest, EveryAlignmentAndLength)
+{
+    const std::vector<uint8_t> frame = make_frame(64U + 130U);
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t len = 0U; len <= 130U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(ext_hex(data, len, false), ref_hex(data, len, false)) << "align = " << align << ", len = " << len;
+            ASSERT_EQ(ext_hex(data, len, true), ref_hex(data, len, true)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+TEST(BytesHexExtTest, AllBytes)
+{
+    uint8_t bytes[256];
+
+    for (int i = 0; i < 256; ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    EXPECT_EQ(ext_hex(bytes, sizeof(bytes), false), ref_hex(bytes, sizeof(bytes), false));
+    EXPECT_EQ(ext_hex(bytes, sizeof(bytes), true), ref_hex(bytes, sizeof(bytes), true));
+}
+
+TEST(BytesHexdumpExtTest, Basic)
+{
+    const char text[] = "Hello, World!\n\x00\x01\x7F\x80" "abc";
+    const auto* const data = reinterpret_cast<const uint8_t*>(text);
+
+    EXPECT_EQ(ext_hexdump(data, sizeof(text) - 1U),
+              "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a 00 01  |Hello, World!...|\n"
+              "00000010  7f 80 61 62 63                                    |..abc|\n");
+    EXPECT_EQ(ext_hexdump(data, 16U),
+              "00000000  48 65 6c 6c 6f 2c 20 57  6f 72 6c 64 21 0a 00 01  |Hello, World!...|\n");
+    EXPECT_EQ(ext_hexdump(data, 0U), "");
+}
+
+TEST(BytesHexdumpExtTest, EveryLength)
+{
+    const std::vector<uint8_t> frame = make_frame(3U + 100U);
+
+    for (std::size_t align = 0U; align < 4U; ++align) {
+        for (std::size_t len = 0U; len <= 100U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(ext_hexdump(data, len), ref_hexdump(data, len)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+/* 所有字节值的可打印判断 */
+TEST(BytesHexdumpExtTest, AllBytes)
+{
+    uint8_t bytes[256];
+
+    for (int i = 0; i < 256; ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    EXPECT_EQ(ext_hexdump(bytes, sizeof(bytes)), ref_hexdump(bytes, sizeof(bytes)));
+}
+
+/* 一个完整的以太网帧，一次调用输出 */
+TEST(BytesHexdumpExtTest, Frame1500)
+{
+    const std::vector<uint8_t> frame = make_frame(1500U);
+
+    const std::string dump = ext_hexdump(frame.data(), frame.size());
+    EXPECT_EQ(dump, ref_hexdump(frame.data(), frame.size()));
+    EXPECT_EQ(dump.find("000005d0  "), 93U * 79U);  // 最后一行的偏移
+}
+
+TEST(BytesBase64ExtTest, Rfc4648Vectors)
+{
+    const auto* const foobar = reinterpret_cast<const uint8_t*>("foobar");
+
+    EXPECT_EQ(ext_base64(foobar, 0U), "");
+    EXPECT_EQ(ext_base64(foobar, 1U), "Zg==");
+    EXPECT_EQ(ext_base64(foobar, 2U), "Zm8=");
+    EXPECT_EQ(ext_base64(foobar, 3U), "Zm9v");
+    EXPECT_EQ(ext_base64(foobar, 4U), "Zm9vYg==");
+    EXPECT_EQ(ext_base64(foobar, 5U), "Zm9vYmE=");
+    EXPECT_EQ(ext_base64(foobar, 6U), "Zm9vYmFy");
+
+    // 字母表两端的 '+' 与 '/'
+    const uint8_t high[] = {0xFB, 0xFF, 0xBF};
+    EXPECT_EQ(ext_base64(high, sizeof(high)), "+/+/");
+}
+
+/* 每步 12 字节输入，覆盖所有起始对齐与尾部长度 */
+TEST(BytesBase64ExtTest, EveryAlignmentAndLength)
+{
+    const std::vector<uint8_t> frame = make_frame(64U + 130U);
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t len = 0U; len <= 130U; ++len) {
+            const uint8_t* const data = frame.data() + align;
+            ASSERT_EQ(ext_base64(data, len), ref_base64(data, len)) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+/* 所有 6 位下标都出现在向量块内 */
+TEST(BytesBase64ExtTest, AllIndices)
+{
+    std::vector<uint8_t> data;
+
+    // 每 3 字节依次编码出下标 i、i + 1、i + 2、i + 3
+    for (unsigned int i = 0U; i < 64U; i += 4U) {
+        const uint32_t v = (i << 18U) | ((i + 1U) << 12U) | ((i + 2U) << 6U) | (i + 3U);
+        data.push_back(static_cast<uint8_t>(v >> 16U));
+        data.push_back(static_cast<uint8_t>(v >> 8U));
+        data.push_back(static_cast<uint8_t>(v));
+    }
+
+    EXPECT_EQ(ext_base64(data.data(), data.size()),
+              "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+}
+
+TEST(BytesBase64ExtTest, Frame1500)
+{
+    const std::vector<uint8_t> frame = make_frame(1500U);
+
+    const std::string b64 = ext_base64(frame.data(), frame.size());
+    EXPECT_EQ(b64, ref_base64(frame.data(), frame.size()));
+    EXPECT_EQ(b64.size(), 2000U);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file code_space_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 代码空间格式字符串测试（由 unit_test_code_space 编译，开启 NVA_CODE_SPACE）
+ *
+ * 主机上 NVA_CODE 为空，NVA_CODE_READ_BYTE 映射到 nva_testCodeReadByte，
+ * 以此确认格式字符串只经由取字节宏读取。
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+
+#include <cstring>
+#include <string>
+
+#ifndef NVA_CODE_SPACE
+#error "code_space_test.cpp must be built with NVA_CODE_SPACE."
+#endif
+
+static struct CodeReadRecord {
+    const char* begin;
+    const char* end;
+    std::size_t total;
+    std::size_t in_range;
+} code_read_record{};
+
+extern "C" char nva_testCodeReadByte(const char* const p)
+{
+    ++code_read_record.total;
+    if (p >= code_read_record.begin && p < code_read_record.end) {
+        ++code_read_record.in_range;
+    }
+
+    return *p;
+}
+
+static std::string print_output;
+
+extern "C" int nva_putchar(const char c)
+{
+    print_output += c;
+
+    return 1;
+}
+
+/* 开始统计落在 [str, str + strlen(str)] 内的读取 */
+static void watch(const char* const str)
+{
+    code_read_record = CodeReadRecord{str, str + std::strlen(str) + 1U, 0U, 0U};
+}
+
+static const char NVA_CODE hello_format[] = "Hello, {}! 0x{:04x}";
+static const char NVA_CODE table_format[] = "|{:<6}|{:>6}|{:^6}|";
+
+TEST(CodeSpaceTest, FormatReadsThroughMacro)
+{
+    char dst[100] = {0};
+
+    watch(hello_format);
+    ASSERT_EQ(nva_format(dst, hello_format, nva_str("world", nva_uint(0xABU, NVA_START))), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "Hello, world! 0x00ab");
+
+    // 格式字符串的每个字节（不含结尾的 '\0'）至少被读取一次
+    EXPECT_GE(code_read_record.in_range, std::strlen(hello_format));
+    EXPECT_GE(code_read_record.total, code_read_record.in_range);
+}
+
+TEST(CodeSpaceTest, PrintReadsThroughMacro)
+{
+    print_output.clear();
+
+    watch(table_format);
+    ASSERT_EQ(nva_print(table_format, nva_int(1, nva_int(22, nva_int(333, NVA_START)))), NVA_SUCCESS);
+    EXPECT_EQ(print_output, "|1     |    22| 333  |");
+    EXPECT_GE(code_read_record.in_range, std::strlen(table_format));
+}
+
+// 普通字面量与代码空间中的格式字符串得到相同的结果
+TEST(CodeSpaceTest, SameAsLiteral)
+{
+    char from_code[100] = {0};
+    char from_literal[100] = {0};
+
+    ASSERT_EQ(nva_format(from_code, table_format, nva_str("a", nva_str("bb", nva_str("ccc", NVA_START)))),
+              NVA_SUCCESS);
+    ASSERT_EQ(nva_format(from_literal, "|{:<6}|{:>6}|{:^6}|", nva_str("a", nva_str("bb", nva_str("ccc", NVA_START)))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(from_code, from_literal);
+
+    ASSERT_EQ(nva_format(from_code, "{:X} {:x} {:.2f}", nva_int(0xBEEF, nva_int(0xBEEF, nva_double(2.5, NVA_START)))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(from_code, "BEEF beef 2.50");
+}
+
+TEST(CodeSpaceTest, ParamError)
+{
+    char dst[10] = {0};
+
+    EXPECT_EQ(nva_format(dst, static_cast<const char NVA_CODE*>(nullptr), NVA_START), NVA_PARAM_ERROR);
+}
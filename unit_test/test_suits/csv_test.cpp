@@ -0,0 +1,291 @@
+/**
+ * @file csv_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 按列模式写出 CSV/TSV 行的 nva_CsvWriter 测试
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/ext/csv.h"
+
+#include <string>
+#include <vector>
+
+/* 记录每次刷出的数据块 */
+static struct FlushRecord {
+    std::string output;
+    std::vector<nva_Size> blocks;
+    nva_ErrorCode result;
+} flush_record{};
+
+static nva_ErrorCode record_flush(void* const ctx, const char* const buf, const nva_Size len)
+{
+    auto* const record = static_cast<FlushRecord*>(ctx);
+    record->output.append(buf, len);
+    record->blocks.push_back(len);
+
+    return record->result;
+}
+
+static const nva_CsvColumn metric_columns[] = {
+    {"name", NVA_TYPEID_STR, ""},
+    {"id", NVA_TYPEID_UINT, "x"},
+    {"delta", NVA_TYPEID_SINT, ""},
+    {"value", NVA_TYPEID_DOUBLE, ".3f"},
+};
+
+class CsvTest : public ::testing::Test
+{
+protected:
+    char buffer[256]{};
+    nva_CsvWriter writer{};
+
+    void SetUp() override
+    {
+        flush_record = FlushRecord{};
+        flush_record.result = NVA_SUCCESS;
+    }
+
+    nva_ErrorCode init(const nva_CsvColumn* columns, const nva_Size count, const char separator,
+                       const nva_Size cap = sizeof(buffer))
+    {
+        return nva_csvWriterInit(&writer, columns, count, separator, buffer, cap, record_flush, &flush_record);
+    }
+
+    nva_ErrorCode writeMetric(const char* name, unsigned int id, int delta, double value)
+    {
+        const void* const values[] = {&name, &id, &delta, &value};
+        return nva_csvWriteRow(&writer, values);
+    }
+};
+
+/*----------------------------------------------------------*/
+/* 表头与按列格式                                              */
+TEST_F(CsvTest, HeaderAndRows)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), ','), NVA_SUCCESS);
+
+    ASSERT_EQ(nva_csvWriteHeader(&writer), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("cpu", 0x1FU, -3, 0.5), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("mem", 255U, 12, 1234.56789), NVA_SUCCESS);
+
+    // 缓冲区未满时不刷出
+    EXPECT_TRUE(flush_record.output.empty());
+
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.output,
+              "name,id,delta,value\r\n"
+              "cpu,1f,-3,0.500\r\n"
+              "mem,ff,12,1234.568\r\n");
+
+    // 空缓冲区刷出不调用回调
+    const std::size_t blocks = flush_record.blocks.size();
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.blocks.size(), blocks);
+}
+
+TEST_F(CsvTest, Tsv)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), '\t'), NVA_SUCCESS);
+
+    ASSERT_EQ(writeMetric("disk io", 10U, 0, -2.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("a,b", 11U, 1, 3.25), NVA_SUCCESS);  // ',' 在 TSV 中不需要引号
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.output,
+              "disk io\ta\t0\t-2.000\r\n"
+              "a,b\tb\t1\t3.250\r\n");
+}
+
+/*----------------------------------------------------------*/
+/* RFC 4180：含分隔符、引号或换行的字段用引号包围，内部引号加倍      */
+TEST_F(CsvTest, Quoting)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), ','), NVA_SUCCESS);
+
+    ASSERT_EQ(writeMetric("a,b", 1U, 1, 1.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("say \"hi\"", 2U, 2, 2.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("line1\nline2", 3U, 3, 3.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("cr\r", 4U, 4, 4.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("", 5U, 5, 5.0), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("plain text; no quotes", 6U, 6, 6.0), NVA_SUCCESS);
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+
+    EXPECT_EQ(flush_record.output,
+              "\"a,b\",1,1,1.000\r\n"
+              "\"say \"\"hi\"\"\",2,2,2.000\r\n"
+              "\"line1\nline2\",3,3,3.000\r\n"
+              "\"cr\r\",4,4,4.000\r\n"
+              ",5,5,5.000\r\n"
+              "plain text; no quotes,6,6,6.000\r\n");
+}
+
+/* 需要引号的字符出现在字段内的每个位置 */
+TEST_F(CsvTest, QuotingEveryPosition)
+{
+    const nva_CsvColumn columns[] = {{"text", NVA_TYPEID_STR, ""}};
+    ASSERT_EQ(init(columns, 1U, ','), NVA_SUCCESS);
+
+    std::string expect;
+    for (const char special : {',', '"', '\n', '\r'}) {
+        for (std::size_t len = 1U; len < 70U; ++len) {
+            for (std::size_t pos = 0U; pos < len; ++pos) {
+                std::string field(len, 'q');
+                field[pos] = special;
+                const char* const str = field.c_str();
+                const void* const values[] = {&str};
+                ASSERT_EQ(nva_csvWriteRow(&writer, values), NVA_SUCCESS);
+
+                std::string quoted = "\"";
+                for (const char c : field) {
+                    quoted += c;
+                    if (c == '"') quoted += '"';
+                }
+                expect += quoted + "\"\r\n";
+            }
+        }
+    }
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.output, expect);
+}
+
+/*----------------------------------------------------------*/
+/* 块刷出：放不下下一行时先刷出，每块不超过缓冲区容量               */
+TEST_F(CsvTest, FlushInBlocks)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), ',', 64U), NVA_SUCCESS);
+
+    std::string expect;
+    char line[128] = {0};
+    for (int i = 0; i < 200; ++i) {
+        const std::string name = "metric_" + std::to_string(i);
+        const auto id = static_cast<unsigned int>(i);
+        ASSERT_EQ(writeMetric(name.c_str(), id, -i, i * 0.25), NVA_SUCCESS);
+
+        ASSERT_EQ(nva_format(line, "{},{:x},{},{:.3f}\r\n",
+                             nva_str(name.c_str(), nva_uint(id, nva_int(-i, nva_double(i * 0.25, NVA_START))))),
+                  NVA_SUCCESS);
+        expect += line;
+    }
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+
+    EXPECT_EQ(flush_record.output, expect);
+    EXPECT_GT(flush_record.blocks.size(), 1U);
+    for (const nva_Size block : flush_record.blocks) {
+        EXPECT_LE(block, 64U);
+        EXPECT_GT(block, 0U);
+    }
+}
+
+/* 单行超过缓冲区容量时失败，且不写出该行的任何部分 */
+TEST_F(CsvTest, RowLargerThanBuffer)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), ',', 32U), NVA_SUCCESS);
+
+    ASSERT_EQ(writeMetric("ok", 1U, 1, 1.0), NVA_SUCCESS);
+    const std::string too_long(40U, 'L');
+    EXPECT_EQ(writeMetric(too_long.c_str(), 2U, 2, 2.0), NVA_FAIL);
+    ASSERT_EQ(writeMetric("ok", 3U, 3, 3.0), NVA_SUCCESS);
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+
+    EXPECT_EQ(flush_record.output, "ok,1,1,1.000\r\nok,3,3,3.000\r\n");
+}
+
+TEST_F(CsvTest, FlushError)
+{
+    ASSERT_EQ(init(metric_columns, NVA_COUNTOF(metric_columns), ','), NVA_SUCCESS);
+    ASSERT_EQ(writeMetric("cpu", 1U, 1, 1.0), NVA_SUCCESS);
+
+    flush_record.result = NVA_FAIL;
+    EXPECT_EQ(nva_csvFlush(&writer), NVA_FAIL);
+}
+
+/*----------------------------------------------------------*/
+/* 列模式在初始化时解析，非法的格式或类型在此时报告                  */
+TEST_F(CsvTest, SchemaErrors)
+{
+    const nva_CsvColumn bad_spec[] = {{"v", NVA_TYPEID_DOUBLE, ".3q"}};
+    EXPECT_EQ(init(bad_spec, 1U, ','), NVA_FAIL);
+
+    const nva_CsvColumn positional[] = {{"v", NVA_TYPEID_SINT, "0:x"}};
+    EXPECT_EQ(init(positional, 1U, ','), NVA_FAIL);  // 列模式中不允许位置参数
+
+    const nva_CsvColumn wrong_type[] = {{"v", NVA_TYPEID_STR, ".3f"}};
+    EXPECT_EQ(init(wrong_type, 1U, ','), NVA_FAIL);
+
+    EXPECT_EQ(nva_csvWriterInit(nullptr, metric_columns, 4U, ',', buffer, sizeof(buffer), record_flush, nullptr),
+              NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_csvWriterInit(&writer, nullptr, 4U, ',', buffer, sizeof(buffer), record_flush, nullptr),
+              NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_csvWriterInit(&writer, metric_columns, 0U, ',', buffer, sizeof(buffer), record_flush, nullptr),
+              NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_csvWriterInit(&writer, metric_columns, 4U, ',', nullptr, sizeof(buffer), record_flush, nullptr),
+              NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_csvWriterInit(&writer, metric_columns, 4U, ',', buffer, sizeof(buffer), nullptr, nullptr),
+              NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_csvWriterInit(&writer, metric_columns, NVA_CSV_MAX_COLUMNS + 1U, ',', buffer, sizeof(buffer),
+                                record_flush, nullptr),
+              NVA_PARAM_ERROR);
+}
+
+/* 与逐行调用 nva_format 的结果相同，覆盖各整数与浮点格式 */
+TEST_F(CsvTest, SameAsFormat)
+{
+    const nva_CsvColumn columns[] = {
+        {"a", NVA_TYPEID_SINT, "+"},   {"b", NVA_TYPEID_UINT, "08X"}, {"c", NVA_TYPEID_SINT, ">6"},
+        {"d", NVA_TYPEID_DOUBLE, "g"}, {"e", NVA_TYPEID_CHAR, ""},    {"f", NVA_TYPEID_DOUBLE, ""},
+    };
+    ASSERT_EQ(init(columns, NVA_COUNTOF(columns), ';'), NVA_SUCCESS);
+
+    std::string expect;
+    char line[128] = {0};
+    const int ints[] = {0, -1, 42, -2147483647 - 1, 2147483647};
+    for (const int v : ints) {
+        const unsigned int u = static_cast<unsigned int>(v);
+        const double d = v / 7.0;
+        const char c = static_cast<char>('a' + (u % 26U));
+        const void* const values[] = {&v, &u, &v, &d, &c, &d};
+        ASSERT_EQ(nva_csvWriteRow(&writer, values), NVA_SUCCESS);
+
+        ASSERT_EQ(nva_format(line, "{:+};{:08X};{:>6};{:g};{};{}\r\n",
+                             nva_int(v, nva_uint(u, nva_int(v, nva_double(d, nva_char(c, nva_double(d, NVA_START))))))),
+                  NVA_SUCCESS);
+        expect += line;
+    }
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.output, expect);
+}
+
+/* 初始化时解码的 short/long/long long 与 f/g 规格，含符号、补零与 '#'，与 nva_format 的结果相同 */
+TEST_F(CsvTest, DecodedSameAsFormat)
+{
+    const nva_CsvColumn columns[] = {
+        {"a", NVA_TYPEID_SSHORT, "+06"}, {"b", NVA_TYPEID_UCHAR, "b"},      {"c", NVA_TYPEID_SLONG, " "},
+        {"d", NVA_TYPEID_SLLONG, "^24"}, {"e", NVA_TYPEID_ULLONG, "016X"}, {"f", NVA_TYPEID_DOUBLE, "+010.3f"},
+        {"g", NVA_TYPEID_FLOAT, "#.0f"}, {"h", NVA_TYPEID_DOUBLE, ".2g"},
+    };
+    ASSERT_EQ(init(columns, NVA_COUNTOF(columns), ';'), NVA_SUCCESS);
+
+    std::string expect;
+    char line[256] = {0};
+    const long long lls[] = {0, -1, 42, -9223372036854775807LL - 1, 9223372036854775807LL};
+    for (const long long v : lls) {
+        const short s = static_cast<short>(v);
+        const unsigned char uc = static_cast<unsigned char>(v);
+        const long l = static_cast<long>(v % 2147483647LL);
+        const unsigned long long ull = static_cast<unsigned long long>(v);
+        const double d = static_cast<double>(v % 100000) / 7.0;
+        const float f = static_cast<float>(d);
+        const void* const values[] = {&s, &uc, &l, &v, &ull, &d, &f, &d};
+        ASSERT_EQ(nva_csvWriteRow(&writer, values), NVA_SUCCESS);
+
+        ASSERT_EQ(nva_format(line, "{:+06};{:b};{: };{:^24};{:016X};{:+010.3f};{:#.0f};{:.2g}\r\n",
+                             nva_short(s, nva_uchar(uc, nva_long(l, nva_llong(v, nva_ullong(ull, nva_double(d,
+                                 nva_float(f, nva_double(d, NVA_START))))))))),
+                  NVA_SUCCESS);
+        expect += line;
+    }
+    ASSERT_EQ(nva_csvFlush(&writer), NVA_SUCCESS);
+    EXPECT_EQ(flush_record.output, expect);
+}
@@ -8,10 +8,15 @@
 #include "gtest/gtest.h"
 
 #include "nva/print.h"
+#include "nva/ext/args.h"
 
 #include <algorithm>
+#include <cstdarg>
 #include <cstdio>
 #include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
 
 #define NVA_TEST_FMT(dst, format, status, expect)                      \
     do {                                                               \
@@ -25,6 +30,17 @@
         EXPECT_STREQ((dst), (expect));                               \
     } while (0)
 
+// 模拟用户已有的 printf 风格封装
+static nva_ErrorCode log_format(char* dst, const char* format, const char* types, ...)
+{
+    va_list args;
+    va_start(args, types);
+    const nva_ErrorCode code = nva_vformat(dst, format, types, args);
+    va_end(args);
+
+    return code;
+}
+
 static const char* ptr_to_string(void* ptr, const uint8_t base, const bool prefix, const bool upper_case)
 {
     static char str[20] = {0};
@@ -274,6 +290,214 @@ TEST(FormatTest, StringTest)
                  "12Hello, World!     \nI\'m nva.34");
 }
 
+#ifdef UNIT_TEST_HAS_STRN
+TEST(FormatTest, StringViewTest)
+{
+    char dst[500];
+
+    const char buffer[] = {'H', 'e', 'l', 'l', 'o', ',', ' ', 'W', 'o', 'r', 'l', 'd'};  // 没有结尾的 '\0'
+
+    NVA_TEST_FMT(dst, "{}", nva_strn(buffer, sizeof(buffer), NVA_START), "Hello, World");
+    NVA_TEST_FMT(dst, "{}", nva_strn(buffer, 5U, NVA_START), "Hello");
+    NVA_TEST_FMT(dst, "[{}]", nva_strn(buffer, 0U, NVA_START), "[]");
+    NVA_TEST_FMT(dst, "[{}]", nva_strn(nullptr, 0U, NVA_START), "[]");
+    NVA_TEST_FMT(dst, "{:s}!", nva_strn(buffer, sizeof(buffer), NVA_START), "Hello, World!");
+
+    NVA_TEST_FMT(dst, "{:.5s}", nva_strn(buffer, sizeof(buffer), NVA_START), "Hello");
+    NVA_TEST_FMT(dst, "{:.0s}|", nva_strn(buffer, sizeof(buffer), NVA_START), "|");
+    NVA_TEST_FMT(dst, "{:.20s}|", nva_strn(buffer, sizeof(buffer), NVA_START), "Hello, World|");
+    NVA_TEST_FMT(dst, "{:>10}|", nva_strn(buffer, 5U, NVA_START), "     Hello|");
+    NVA_TEST_FMT(dst, "{:*^9}|", nva_strn(buffer, 5U, NVA_START), "**Hello**|");
+    NVA_TEST_FMT(dst, "{:<8.2}|", nva_strn(buffer, sizeof(buffer), NVA_START), "He      |");
+    NVA_TEST_FMT(dst, "{:3}|", nva_strn(buffer, sizeof(buffer), NVA_START), "Hello, World|");
+
+    // 与 nva_str 混合使用，且在格式中重复引用
+    NVA_TEST_FMT(dst, "{1}{0}{1}", nva_strn(buffer, 5U, nva_str("--", NVA_START)), "--Hello--");
+
+    // 长字符串整块拷贝
+    const std::string long_str(400, 'z');
+    NVA_TEST_FMT(dst, "<{}>", nva_strn(long_str.data(), long_str.size(), NVA_START), ("<" + long_str + ">").c_str());
+
+    const std::string_view view{"std::string_view, but longer than needed"};
+    NVA_TEST_FMT_CPP(dst, "{}", nva::add(view.substr(0, 16), NVA_START), "std::string_view");
+    NVA_TEST_FMT_CPP(dst, "{:>20.3}|", nva::add(view, NVA_START), "                 std|");
+    NVA_TEST_FMT_CPP(dst, "{} = {}", nva::add(std::string_view{"key"}, nva::add(123, NVA_START)), "key = 123");
+}
+#endif /* UNIT_TEST_HAS_STRN */
+
+TEST(FormatTest, PushArgsTest)
+{
+    char dst[100];
+
+    const int a = 1;
+    const unsigned int b = 0xFFU;
+    const double c = 3.14159;
+    const char* const d = "abra";
+
+    // values[i] 对应格式中的 {i}
+    const nva_TypeId types[] = {NVA_TYPEID_SINT, NVA_TYPEID_UINT, NVA_TYPEID_DOUBLE, NVA_TYPEID_STR};
+    const void* const values[] = {&a, &b, &c, &d};
+
+    NVA_TEST_FMT(dst, "{} {:#x} {:.2f} {}", nva_pushArgs(types, values, 4U, NVA_START), "1 0xff 3.14 abra");
+    NVA_TEST_FMT(dst, "{3}{0}{3}", nva_pushArgs(types, values, 4U, NVA_START), "abra1abra");
+    NVA_TEST_FMT(dst, "no args", nva_pushArgs(types, values, 0U, NVA_START), "no args");
+
+    // 与逐个压入的参数链混用：批量参数排在前面
+    NVA_TEST_FMT(dst, "{} {} {}", nva_pushArgs(types, values, 2U, nva_int(7, NVA_START)), "1 255 7");
+
+    EXPECT_EQ(nva_format(dst, "{}", nva_pushArgs(types, values, 1U, NVA_ERROR)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{}", nva_pushArgs(nullptr, values, 1U, NVA_START)), NVA_FAIL);
+}
+
+TEST(FormatTest, VFormatTest)
+{
+    char dst[100];
+
+    // 类型字符串与 Python struct 模块一致：b/B h/H i/I l/L q/Q 为有/无符号整型，c 字符，f/d 浮点，s 字符串，p 指针
+    EXPECT_EQ(log_format(dst, "{} {} {}", "iIc", -1, 2U, 'x'), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "-1 2 x");
+
+    EXPECT_EQ(log_format(dst, "{:+} {:x} {:o}", "hHb", -12, 0xABCD, 8), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "-12 abcd 10");
+
+    EXPECT_EQ(log_format(dst, "{} {}", "lL", -123456789L, 123456789UL), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "-123456789 123456789");
+
+    EXPECT_EQ(log_format(dst, "{} {}", "qQ", -1234567890123LL, 18446744073709551615ULL), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "-1234567890123 18446744073709551615");
+
+    EXPECT_EQ(log_format(dst, "{:.3f} {:.2f}", "fd", 1.456, 123.456), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "1.456 123.46");
+
+    EXPECT_EQ(log_format(dst, "{1}, {0}!", "ss", "world", "Hello"), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "Hello, world!");
+
+    int a;
+    EXPECT_EQ(log_format(dst, "{}", "p", static_cast<void*>(&a)), NVA_SUCCESS);
+    EXPECT_STREQ(dst, ptr_to_string(&a, 16, true, false));
+
+    EXPECT_EQ(log_format(dst, "plain", ""), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "plain");
+
+    EXPECT_EQ(log_format(dst, "{} {} {} {} {} {} {} {} {} {}", "iIhHbBlLqQ", 0, 1U, 2, 3, 4, 5, 6L, 7UL, 8LL, 9ULL),
+              NVA_SUCCESS);
+    EXPECT_STREQ(dst, "0 1 2 3 4 5 6 7 8 9");
+
+    EXPECT_EQ(log_format(dst, "{}", "?", 1), NVA_PARAM_ERROR);
+    // 未知字符出现在已知字符之后时同样不压入任何参数，不影响之后的调用
+    EXPECT_EQ(log_format(dst, "{}", "i?", 1, 2), NVA_PARAM_ERROR);
+    EXPECT_EQ(log_format(dst, "{}", "i", 3), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "3");
+    EXPECT_EQ(log_format(dst, "{}", nullptr), NVA_PARAM_ERROR);
+    EXPECT_EQ(log_format(nullptr, "{}", "i", 1), NVA_PARAM_ERROR);
+}
+
+// 每个类型 ID 都要走到正确的取值、符号扩展与转换分支。
+// 也是类型ID跳转表（尚待 nva_print 实现）的回归测试：改为查表之后结果必须不变
+TEST(FormatTest, TypeDispatchTest)
+{
+    char dst[100];
+
+#define NVA_TEST_FMT_LIMITS(type)                                                                     \
+    do {                                                                                              \
+        const auto min_v = std::numeric_limits<type>::min();                                          \
+        const auto max_v = std::numeric_limits<type>::max();                                          \
+        const auto expect = std::to_string(min_v) + " " + std::to_string(max_v);                      \
+        NVA_TEST_FMT_CPP(dst, "{} {}", nva::add(min_v, nva::add(max_v, NVA_START)), expect.c_str()); \
+    } while (0)
+
+    NVA_TEST_FMT_LIMITS(short);
+    NVA_TEST_FMT_LIMITS(unsigned short);
+    NVA_TEST_FMT_LIMITS(int);
+    NVA_TEST_FMT_LIMITS(unsigned int);
+    NVA_TEST_FMT_LIMITS(long);
+    NVA_TEST_FMT_LIMITS(unsigned long);
+    NVA_TEST_FMT_LIMITS(long long);
+    NVA_TEST_FMT_LIMITS(unsigned long long);
+
+#undef NVA_TEST_FMT_LIMITS
+
+    // signed char 与 unsigned char 按整数输出，char 按字符输出
+    NVA_TEST_FMT_CPP(dst,
+                     "{} {} {}",
+                     nva::add(static_cast<signed char>(-128),
+                              nva::add(static_cast<unsigned char>(255), nva::add('c', NVA_START))),
+                     "-128 255 c");
+
+    // 同一个格式中混合所有类型，相邻参数的类型各不相同
+    const char c = 'c';
+    const short ss = -1;
+    const unsigned short us = 65535U;
+    const int si = -2;
+    const unsigned int ui = 4294967295U;
+    const long long sll = -3LL;
+    int a;
+    const void* const p = &a;
+    const char* const str = "str";
+    const float f = 1.5f;
+    const double d = 2.25;
+
+    const nva_TypeId types[] = {NVA_TYPEID_CHAR,
+                                NVA_TYPEID_SSHORT,
+                                NVA_TYPEID_USHORT,
+                                NVA_TYPEID_SINT,
+                                NVA_TYPEID_UINT,
+                                NVA_TYPEID_SLLONG,
+                                NVA_TYPEID_PTR,
+                                NVA_TYPEID_STR,
+                                NVA_TYPEID_FLOAT,
+                                NVA_TYPEID_DOUBLE};
+    const void* const values[] = {&c, &ss, &us, &si, &ui, &sll, &p, &str, &f, &d};
+
+    const auto expect =
+        std::string{"c -1 65535 -2 4294967295 -3 "} + ptr_to_string(&a, 16, true, false) + " str 1.50 2.25";
+    NVA_TEST_FMT(dst,
+                 "{} {} {} {} {} {} {} {} {:.2f} {:.2f}",
+                 nva_pushArgs(types, values, NVA_COUNTOF(types), NVA_START),
+                 expect.c_str());
+
+    // 无效的类型 ID 不能被当作任何类型处理
+    const int v = 1;
+    const nva_TypeId bad_types[] = {0x56};
+    const void* const bad_values[] = {&v};
+    EXPECT_NE(nva_format(dst, "{}", nva_pushArgs(bad_types, bad_values, 1U, NVA_START)), NVA_SUCCESS);
+}
+
+#ifdef UNIT_TEST_HAS_HIGH_WATER
+// 参数栈与输出的高水位：峰值只增不减，直到重置
+TEST(FormatTest, HighWaterTest)
+{
+    char dst[100] = {0};
+    nva_HighWater hw{};
+
+    nva_highWaterReset();
+    nva_highWaterGet(&hw);
+    EXPECT_EQ(hw.type_peak, 0U);
+    EXPECT_EQ(hw.data_peak, 0U);
+    EXPECT_EQ(hw.output_peak, 0U);
+
+    NVA_TEST_FMT(dst, "{} {}", nva_int(1, nva_double(2.5, NVA_START)), "1 2.5");
+    nva_highWaterGet(&hw);
+    EXPECT_EQ(hw.type_peak, 2U);
+    EXPECT_EQ(hw.data_peak, sizeof(int) + sizeof(double));
+    EXPECT_EQ(hw.output_peak, 5U);
+
+    // 更短的调用不会降低峰值
+    NVA_TEST_FMT(dst, "{}", nva_char('x', NVA_START), "x");
+    nva_highWaterGet(&hw);
+    EXPECT_EQ(hw.type_peak, 2U);
+    EXPECT_EQ(hw.output_peak, 5U);
+
+    NVA_TEST_FMT(dst, "{:>20}", nva_str("abc", NVA_START), "                 abc");
+    nva_highWaterGet(&hw);
+    EXPECT_EQ(hw.output_peak, 20U);
+
+    nva_highWaterReset();
+    nva_highWaterGet(&hw);
+    EXPECT_EQ(hw.output_peak, 0U);
+}
+#endif /* UNIT_TEST_HAS_HIGH_WATER */
+
 // 先测试辅助函数 ptr_to_string
 TEST(FormatTest, PtrTest_ptr_to_string_FuncTest)
 {
@@ -326,3 +550,44 @@ TEST(FormatTest, FloatTest)
     NVA_TEST_FMT_CPP(dst, "{:|^+10.3f}", nva::add(123.456, NVA_START), "|+123.456|");
     NVA_TEST_FMT_CPP(dst, "{:|^-10.3f}", nva::add(123.456, NVA_START), "|123.456||");
 }
+
+// 宽填充与长字面量段，覆盖填充写入与 '{'/'}' 查找的整字/向量路径
+TEST(FormatTest, WidePaddingTest)
+{
+    char dst[512] = {0};
+    char format[32] = {0};
+
+    for (int width = 1; width <= 200; ++width) {
+        const int left = (width > 3) ? (width - 3) / 2 : 0;
+        const int right = (width > 3) ? width - 3 - left : 0;
+
+        std::snprintf(format, sizeof(format), "{:*^%d}", width);
+        NVA_TEST_FMT(dst, format, nva_str("abc", NVA_START),
+                     (std::string(left, '*') + "abc" + std::string(right, '*')).c_str());
+
+        std::snprintf(format, sizeof(format), "{:0%d}", width);
+        const std::string zero_padded = (width > 3) ? "-" + std::string(width - 3, '0') + "42" : "-42";
+        NVA_TEST_FMT(dst, format, nva_int(-42, NVA_START), zero_padded.c_str());
+    }
+
+    NVA_TEST_FMT(dst, "{:*^30}", nva_str("title", NVA_START), "************title*************");
+    NVA_TEST_FMT(dst, "{:012f}", nva_double(-1.5, NVA_START), "-0001.500000");
+}
+
+TEST(FormatTest, LongLiteralTest)
+{
+    char dst[1024] = {0};
+
+    for (std::size_t len = 0U; len < 300U; len += 7U) {
+        const std::string run(len, 'r');
+
+        // 字面量段之后的第一个 '{' 或 '}' 必须被找到
+        NVA_TEST_FMT(dst, (run + "{}").c_str(), nva_int(1, NVA_START), (run + "1").c_str());
+        NVA_TEST_FMT(dst, (run + "{{" + run + "}}").c_str(), NVA_START, (run + "{" + run + "}").c_str());
+        NVA_TEST_FMT(dst, run.c_str(), NVA_START, run.c_str());
+    }
+
+    // 高位字节与 '{' 相邻
+    NVA_TEST_FMT(dst, "\xE4\xBD\xA0\xE5\xA5\xBD{}\xEF\xBC\x81", nva_str("nva", NVA_START),
+                 "\xE4\xBD\xA0\xE5\xA5\xBDnva\xEF\xBC\x81");
+}
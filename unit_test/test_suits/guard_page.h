@@ -0,0 +1,103 @@
+/**
+ * @file guard_page.h
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 前后带不可访问保护页的缓冲区，用于检查字符串函数的读取是否越过页边界
+ *
+ * 只在 POSIX 平台上设置保护页；其他平台或 mmap/mprotect 失败时退化为普通缓冲区，测试仍然检查结果是否正确。
+ */
+
+#pragma once
+#ifndef NVA_TEST_GUARD_PAGE_H
+#define NVA_TEST_GUARD_PAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define NVA_TEST_HAS_GUARD_PAGE 1
+#else
+#define NVA_TEST_HAS_GUARD_PAGE 0
+#endif
+
+class GuardPage
+{
+public:
+    /* 可访问区域至少为 size 字节，并向上取整到整页 */
+    explicit GuardPage(const std::size_t size)
+    {
+#if NVA_TEST_HAS_GUARD_PAGE
+        page_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        size_ = (size + page_ - 1U) / page_ * page_;
+        if (size_ == 0U) size_ = page_;
+
+        void* const base =
+            mmap(nullptr, size_ + 2U * page_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+            unsigned char* const bytes = static_cast<unsigned char*>(base);
+            // 保护页设置失败时与 mmap 失败一样退化为普通缓冲区，不能让测试以为越界读取会被捕获
+            if (mprotect(bytes, page_, PROT_NONE) == 0 && mprotect(bytes + page_ + size_, page_, PROT_NONE) == 0) {
+                base_ = bytes;
+                begin_ = base_ + page_;
+                return;
+            }
+            munmap(base, size_ + 2U * page_);
+        }
+#endif
+        page_ = 4096U;
+        size_ = (size + page_ - 1U) / page_ * page_;
+        if (size_ == 0U) size_ = page_;
+        fallback_.resize(size_);
+        begin_ = fallback_.data();
+    }
+
+    ~GuardPage()
+    {
+#if NVA_TEST_HAS_GUARD_PAGE
+        if (base_ != nullptr) munmap(base_, size_ + 2U * page_);
+#endif
+    }
+
+    GuardPage(const GuardPage&) = delete;
+    GuardPage& operator=(const GuardPage&) = delete;
+
+    /* 第一个可访问字节，紧跟在前保护页之后 */
+    unsigned char* begin() const { return begin_; }
+
+    /* 最后一个可访问字节之后的位置，即后保护页的起点 */
+    unsigned char* end() const { return begin_ + size_; }
+
+    std::size_t size() const { return size_; }
+    std::size_t pageSize() const { return page_; }
+
+    /* 在末尾放置长度为 len 的字符串，使结尾的 '\0' 恰好是保护页之前的最后一个字节 */
+    char* stringAtEnd(const std::size_t len, const unsigned char fill = 'a') const
+    {
+        char* const str = reinterpret_cast<char*>(end()) - len - 1U;
+        std::memset(str, fill, len);
+        str[len] = '\0';
+        return str;
+    }
+
+    /* 在开头放置长度为 len 的字符串 */
+    char* stringAtBegin(const std::size_t len, const unsigned char fill = 'a') const
+    {
+        char* const str = reinterpret_cast<char*>(begin());
+        std::memset(str, fill, len);
+        str[len] = '\0';
+        return str;
+    }
+
+private:
+    unsigned char* base_ = nullptr;
+    unsigned char* begin_ = nullptr;
+    std::size_t page_ = 0U;
+    std::size_t size_ = 0U;
+    std::vector<unsigned char> fallback_;
+};
+
+#endif  // !NVA_TEST_GUARD_PAGE_H
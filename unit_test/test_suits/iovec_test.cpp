@@ -0,0 +1,209 @@
+/**
+ * @file iovec_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 分段（iovec）格式化测试
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+static std::string join_iov(const nva_IoVec* iov, const nva_Size count)
+{
+    std::string str;
+
+    for (nva_Size i = 0U; i < count; ++i) {
+        str.append(iov[i].base, iov[i].len);
+    }
+
+    return str;
+}
+
+static bool points_into(const nva_IoVec& vec, const char* begin, const std::size_t len)
+{
+    return vec.base >= begin && vec.base + vec.len <= begin + len;
+}
+
+class IovecTest : public ::testing::Test
+{
+protected:
+    std::array<nva_IoVec, 32> iov{};
+    nva_Size count = 0U;
+    char scratch[128]{};
+    char dst[512]{};
+
+    nva_ErrorCode formatIov(const char* format, const nva_ErrorCode status)
+    {
+        count = iov.size();
+        return nva_formatIov(iov.data(), &count, scratch, sizeof(scratch), format, status);
+    }
+};
+
+#define NVA_TEST_FMT_IOV(format, status, expect)                     \
+    do {                                                             \
+        ASSERT_EQ(formatIov((format), (status)), NVA_SUCCESS);       \
+        EXPECT_EQ(join_iov(iov.data(), count), std::string{expect}); \
+    } while (0)
+
+TEST_F(IovecTest, ParamError)
+{
+    nva_Size n = iov.size();
+
+    EXPECT_EQ(nva_formatIov(nullptr, &n, scratch, sizeof(scratch), "x", NVA_START), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatIov(iov.data(), nullptr, scratch, sizeof(scratch), "x", NVA_START), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatIov(iov.data(), &n, scratch, sizeof(scratch), nullptr, NVA_START), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatIov(iov.data(), &n, scratch, sizeof(scratch), "x", NVA_ERROR), NVA_FAIL);
+}
+
+TEST_F(IovecTest, LiteralOnly)
+{
+    const char* const format = "Hello, World!";
+
+    NVA_TEST_FMT_IOV(format, NVA_START, "Hello, World!");
+    ASSERT_EQ(count, 1U);
+    EXPECT_EQ(iov[0].base, format);  // 字面量直接引用格式字符串
+
+    NVA_TEST_FMT_IOV("", NVA_START, "");
+    EXPECT_EQ(count, 0U);
+
+    NVA_TEST_FMT_IOV("std::vector vec{{1, 2, 3, 4}};", NVA_START, "std::vector vec{1, 2, 3, 4};");
+}
+
+TEST_F(IovecTest, StringIsReferenced)
+{
+    const std::string payload(4096, 'p');
+    const char* const format = "body=[{}] end";
+
+    NVA_TEST_FMT_IOV(format, nva_str(payload.c_str(), NVA_START), "body=[" + payload + "] end");
+
+    ASSERT_EQ(count, 3U);
+    EXPECT_TRUE(points_into(iov[0], format, std::strlen(format)));
+    EXPECT_EQ(iov[1].base, payload.c_str());  // 参数字符串没有被拷贝
+    EXPECT_EQ(iov[1].len, payload.size());
+    EXPECT_TRUE(points_into(iov[2], format, std::strlen(format)));
+}
+
+TEST_F(IovecTest, PaddingGoesToScratch)
+{
+    const char* const str = "Hello, World!";
+    const char* const format = "12{:>20}34";
+
+    NVA_TEST_FMT_IOV(format, nva_str(str, NVA_START), "12       Hello, World!34");
+
+    // 填充字符写入暂存区，字符串本身仍然直接引用
+    int referenced = 0;
+    for (nva_Size i = 0U; i < count; ++i) {
+        if (iov[i].base == str) {
+            ++referenced;
+            EXPECT_EQ(iov[i].len, std::strlen(str));
+        }
+        else if (!points_into(iov[i], format, std::strlen(format))) {
+            EXPECT_TRUE(points_into(iov[i], scratch, sizeof(scratch)));
+        }
+    }
+    EXPECT_EQ(referenced, 1);
+
+    NVA_TEST_FMT_IOV("[{:*^17}]", nva_str(str, NVA_START), "[**Hello, World!**]");
+}
+
+TEST_F(IovecTest, PrecisionTruncatesReference)
+{
+    const char* const str = "Hello, World!";
+
+    NVA_TEST_FMT_IOV("{:.5s}", nva_str(str, NVA_START), "Hello");
+    ASSERT_EQ(count, 1U);
+    EXPECT_EQ(iov[0].base, str);
+    EXPECT_EQ(iov[0].len, 5U);
+}
+
+TEST_F(IovecTest, SameAsFormat)
+{
+    // 每个格式字符串配一组类型匹配的参数，两次调用各自重新压栈
+    struct Case {
+        const char* format;
+        nva_ErrorCode (*args)();
+    };
+
+    const Case cases[] = {
+        {"arr = [{2:^.5d}, {0:*^3.3d}, {1::^#5.4}].\n",
+         [] { return nva_int(12, nva_int(27, nva_int(3, NVA_START))); }},
+        {"arr = [{:5d}, {:08d}, {:#07x}].\n", [] { return nva_int(123, nva_int(1456, nva_int(0x653, NVA_START))); }},
+        {"Number: {1}, Hex: {0:x}, FloatPoint: {2:.2f}",
+         [] { return nva_int(0xFF, nva_int(42, nva_double(3.14159, NVA_START))); }},
+        {"{0}{1}{0}", [] { return nva_str("abra", nva_str("cad", NVA_START)); }},
+        {"12{:15}{:>12}34", [] { return nva_str("abra", nva_str("cad", NVA_START)); }},
+        {"{1:<9}|{0:^9}|", [] { return nva_str("abra", nva_str("cad", NVA_START)); }},
+    };
+
+    for (const auto& c : cases) {
+        ASSERT_EQ(nva_format(dst, c.format, c.args()), NVA_SUCCESS) << "format = " << c.format;
+        ASSERT_EQ(formatIov(c.format, c.args()), NVA_SUCCESS) << "format = " << c.format;
+        EXPECT_EQ(join_iov(iov.data(), count), std::string{dst}) << "format = " << c.format;
+    }
+}
+
+TEST_F(IovecTest, NotEnoughSegments)
+{
+    nva_Size n = 2U;
+
+    EXPECT_EQ(nva_formatIov(iov.data(), &n, scratch, sizeof(scratch), "a{}b{}c", nva_int(1, nva_int(2, NVA_START))),
+              NVA_FAIL);
+}
+
+TEST_F(IovecTest, NotEnoughScratch)
+{
+    nva_Size n = iov.size();
+    char small[2];
+
+    EXPECT_EQ(nva_formatIov(iov.data(), &n, small, sizeof(small), "{}", nva_int(123456, NVA_START)), NVA_FAIL);
+
+    // 只有字面量与字符串引用时不需要暂存区
+    n = iov.size();
+    EXPECT_EQ(nva_formatIov(iov.data(), &n, nullptr, 0U, "<{}>", nva_str("zero copy", NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(join_iov(iov.data(), n), "<zero copy>");
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_F(IovecTest, WritevSink)
+{
+    const std::string payload(2000, 'x');
+
+    ASSERT_EQ(formatIov("GET {} HTTP/1.1\r\nHost: {}\r\n\r\n",
+                        nva_str(payload.c_str(), nva_str("example.com", NVA_START))),
+              NVA_SUCCESS);
+
+    std::vector<struct iovec> vecs(count);
+    for (nva_Size i = 0U; i < count; ++i) {
+        vecs[i].iov_base = const_cast<char*>(iov[i].base);
+        vecs[i].iov_len = iov[i].len;
+    }
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    const auto expect = "GET " + payload + " HTTP/1.1\r\nHost: example.com\r\n\r\n";
+    EXPECT_EQ(writev(fds[1], vecs.data(), static_cast<int>(vecs.size())), static_cast<ssize_t>(expect.size()));
+    close(fds[1]);
+
+    std::string received(expect.size(), '\0');
+    std::size_t got = 0U;
+    ssize_t n;
+    while ((n = read(fds[0], received.data() + got, received.size() - got)) > 0) {
+        got += static_cast<std::size_t>(n);
+    }
+    close(fds[0]);
+
+    EXPECT_EQ(received, expect);
+}
+#endif
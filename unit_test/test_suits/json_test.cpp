@@ -0,0 +1,434 @@
+/**
+ * @file json_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief JSON 转义格式 {:j} 与结构化 JSON 行输出测试
+ *
+ * {:j} 与 nva_formatJson 由 nva_print 提供，仅在配置时检测到 nva/json.h 后测试（UNIT_TEST_HAS_JSON）；
+ * nva_ext 的 nva_jsonEscape 与 nva_formatJsonArgs 总是测试。
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/ext/json.h"
+#ifdef UNIT_TEST_HAS_JSON
+#include "nva/json.h"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#define NVA_TEST_FMT(dst, format, status, expect)                      \
+    do {                                                               \
+        EXPECT_EQ(nva_format((dst), (format), (status)), NVA_SUCCESS); \
+        EXPECT_STREQ((dst), (expect));                                 \
+    } while (0)
+
+#define NVA_TEST_JSON(dst, keys, status, expect)                                            \
+    do {                                                                                    \
+        EXPECT_EQ(nva_formatJson((dst), (keys), NVA_COUNTOF(keys), (status)), NVA_SUCCESS); \
+        EXPECT_STREQ((dst), (expect));                                                      \
+    } while (0)
+
+#define NVA_TEST_JSON_ARGS(dst, keys, types, values, expect)                                                          \
+    do {                                                                                                              \
+        EXPECT_EQ(nva_formatJsonArgs((dst), sizeof(dst), (keys), (types), (values), NVA_COUNTOF(keys)), NVA_SUCCESS); \
+        EXPECT_STREQ((dst), (expect));                                                                                \
+    } while (0)
+
+/* 参考实现：逐字节转义 */
+static std::string json_escape(const std::string& str)
+{
+    static const char hex[] = "0123456789abcdef";
+    std::string out;
+
+    for (const char ch : str) {
+        const auto c = static_cast<unsigned char>(ch);
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20U) {
+                    out += "\\u00";
+                    out += hex[c >> 4U];
+                    out += hex[c & 0x0FU];
+                }
+                else {
+                    out += ch;
+                }
+                break;
+        }
+    }
+
+    return out;
+}
+
+#ifdef UNIT_TEST_HAS_JSON
+/*----------------------------------------------------------*/
+/* {:j}：只转义，不添加引号                                     */
+TEST(JsonEscapeTest, Basic)
+{
+    char dst[256] = {0};
+
+    NVA_TEST_FMT(dst, "{:j}", nva_str("plain text", NVA_START), "plain text");
+    NVA_TEST_FMT(dst, "{:j}", nva_str("", NVA_START), "");
+    NVA_TEST_FMT(dst, "\"{:j}\"", nva_str("say \"hi\"", NVA_START), "\"say \\\"hi\\\"\"");
+    NVA_TEST_FMT(dst, "{:j}", nva_str("C:\\temp\\log", NVA_START), "C:\\\\temp\\\\log");
+    NVA_TEST_FMT(dst, "{:j}", nva_str("a\nb\tc\rd\be\ff", NVA_START), "a\\nb\\tc\\rd\\be\\ff");
+    NVA_TEST_FMT(dst, "{:j}", nva_str("\x01\x1F\x7F", NVA_START), "\\u0001\\u001f\x7F");
+
+    // UTF-8 多字节序列原样输出
+    NVA_TEST_FMT(dst, "{:j}", nva_str("\xE4\xBD\xA0\xE5\xA5\xBD", NVA_START), "\xE4\xBD\xA0\xE5\xA5\xBD");
+
+    // 字符串视图同样可以转义，长度之外的字节不参与
+    NVA_TEST_FMT(dst, "{:j}", nva_strn("a\"b\"c", 3U, NVA_START), "a\\\"b");
+}
+
+/* 需要转义的字符出现在向量块内的每个位置 */
+TEST(JsonEscapeTest, EveryPosition)
+{
+    char dst[512] = {0};
+    const char specials[] = {'"', '\\', '\n', '\x01', '\x1F', '\t'};
+
+    for (const char special : specials) {
+        for (std::size_t len = 1U; len < 80U; ++len) {
+            for (std::size_t pos = 0U; pos < len; ++pos) {
+                std::string str(len, 'v');
+                str[pos] = special;
+                ASSERT_EQ(nva_format(dst, "{:j}", nva_str(str.c_str(), NVA_START)), NVA_SUCCESS);
+                ASSERT_EQ(std::string(dst), json_escape(str))
+                    << "special = " << static_cast<int>(special) << ", len = " << len << ", pos = " << pos;
+            }
+        }
+    }
+}
+
+/* 所有单字节值（'\0' 除外）与参考实现一致 */
+TEST(JsonEscapeTest, AllBytes)
+{
+    char dst[2048] = {0};
+    std::string str;
+
+    for (int c = 1; c < 256; ++c) {
+        str += static_cast<char>(c);
+    }
+
+    ASSERT_EQ(nva_format(dst, "{:j}", nva_str(str.c_str(), NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(std::string(dst), json_escape(str));
+}
+
+TEST(JsonEscapeTest, NonStringArgument)
+{
+    char dst[64] = {0};
+
+    EXPECT_EQ(nva_format(dst, "{:j}", nva_int(1, NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_format(dst, "{:j}", nva_double(1.5, NVA_START)), NVA_FAIL);
+
+    // 失败之后参数栈被清空，后续调用不受影响
+    NVA_TEST_FMT(dst, "{:j}", nva_str("ok", NVA_START), "ok");
+}
+
+/*----------------------------------------------------------*/
+/* nva_formatJson：由键名与参数栈生成一行 JSON 对象              */
+TEST(JsonLineTest, Types)
+{
+    char dst[256] = {0};
+
+    const char* const keys[] = {"level", "code", "count", "ratio", "flag", "msg"};
+    NVA_TEST_JSON(dst, keys,
+                  nva_str("info",
+                          nva_int(-42, nva_uint(7U, nva_double(2.5, nva_char('y', nva_str("done", NVA_START)))))),
+                  "{\"level\":\"info\",\"code\":-42,\"count\":7,\"ratio\":2.5,\"flag\":\"y\",\"msg\":\"done\"}");
+
+    const char* const one[] = {"id"};
+    NVA_TEST_JSON(dst, one, nva_ullong(18446744073709551615ULL, NVA_START), "{\"id\":18446744073709551615}");
+
+    const char* const none[] = {nullptr};
+    EXPECT_EQ(nva_formatJson(dst, none, 0U, NVA_START), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "{}");
+}
+
+TEST(JsonLineTest, EscapesKeysAndValues)
+{
+    char dst[256] = {0};
+
+    const char* const keys[] = {"path", "quote\"key", "text"};
+    NVA_TEST_JSON(dst, keys,
+                  nva_str("C:\\log", nva_int(1, nva_str("line1\nline2\t\"x\"", NVA_START))),
+                  "{\"path\":\"C:\\\\log\",\"quote\\\"key\":1,\"text\":\"line1\\nline2\\t\\\"x\\\"\"}");
+}
+
+/* 非有限的浮点数没有 JSON 表示，输出 null */
+TEST(JsonLineTest, NonFinite)
+{
+#ifndef NVA_NO_INF_AND_NAN
+    char dst[128] = {0};
+
+    const char* const keys[] = {"inf", "nan", "ok"};
+    NVA_TEST_JSON(dst, keys,
+                  nva_double(std::numeric_limits<double>::infinity(),
+                             nva_double(std::nan(""), nva_double(-0.5, NVA_START))),
+                  "{\"inf\":null,\"nan\":null,\"ok\":-0.5}");
+#else
+    GTEST_SKIP() << "NVA_NO_INF_AND_NAN";
+#endif
+}
+
+TEST(JsonLineTest, Errors)
+{
+    char dst[128] = {0};
+
+    // 键的数量与参数数量不一致
+    const char* const two[] = {"a", "b"};
+    EXPECT_EQ(nva_formatJson(dst, two, 2U, nva_int(1, NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_formatJson(dst, two, 1U, nva_int(1, nva_int(2, NVA_START))), NVA_FAIL);
+
+    EXPECT_EQ(nva_formatJson(nullptr, two, 2U, nva_int(1, nva_int(2, NVA_START))), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatJson(dst, nullptr, 2U, nva_int(1, nva_int(2, NVA_START))), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatJson(dst, two, 2U, NVA_ERROR), NVA_FAIL);
+
+    // 失败之后参数栈被清空，后续调用不受影响
+    NVA_TEST_JSON(dst, two, nva_int(1, nva_int(2, NVA_START)), "{\"a\":1,\"b\":2}");
+}
+
+/* 与先转义再 nva_format 两遍的做法结果相同 */
+TEST(JsonLineTest, SameAsTwoPass)
+{
+    char dst[512] = {0};
+    char two_pass[512] = {0};
+    const std::string msg = "user \"root\" logged in from C:\\Users\n\x02";
+
+    const char* const keys[] = {"ts", "msg"};
+    ASSERT_EQ(nva_formatJson(dst, keys, 2U, nva_ulong(1760832000UL, nva_str(msg.c_str(), NVA_START))), NVA_SUCCESS);
+
+    const std::string escaped = json_escape(msg);
+    ASSERT_EQ(nva_format(two_pass, "{{\"ts\":{},\"msg\":\"{}\"}}",
+                         nva_ulong(1760832000UL, nva_str(escaped.c_str(), NVA_START))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(dst, two_pass);
+
+    ASSERT_EQ(nva_format(two_pass, "{{\"ts\":{},\"msg\":\"{:j}\"}}",
+                         nva_ulong(1760832000UL, nva_str(msg.c_str(), NVA_START))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(dst, two_pass);
+}
+#endif /* UNIT_TEST_HAS_JSON */
+
+/*----------------------------------------------------------*/
+/* nva_jsonEscape：按长度转义，不添加引号                       */
+static std::string ext_json_escape(const std::string& str)
+{
+    std::string dst(6U * str.size() + 1U, '#');
+    const nva_Size len = nva_jsonEscape(&dst[0], str.data(), str.size());
+
+    EXPECT_EQ(dst[len], '\0');
+    return dst.substr(0U, len);
+}
+
+TEST(JsonEscapeExtTest, Basic)
+{
+    EXPECT_EQ(ext_json_escape("plain text"), "plain text");
+    EXPECT_EQ(ext_json_escape(""), "");
+    EXPECT_EQ(ext_json_escape("say \"hi\""), "say \\\"hi\\\"");
+    EXPECT_EQ(ext_json_escape("C:\\temp\\log"), "C:\\\\temp\\\\log");
+    EXPECT_EQ(ext_json_escape("a\nb\tc\rd\be\ff"), "a\\nb\\tc\\rd\\be\\ff");
+    EXPECT_EQ(ext_json_escape("\x01\x1F\x7F"), "\\u0001\\u001f\x7F");
+
+    // UTF-8 多字节序列原样输出
+    EXPECT_EQ(ext_json_escape("\xE4\xBD\xA0\xE5\xA5\xBD"), "\xE4\xBD\xA0\xE5\xA5\xBD");
+
+    // 按长度处理，'\0' 同样转义
+    EXPECT_EQ(ext_json_escape(std::string("a\0b", 3U)), "a\\u0000b");
+}
+
+/* 需要转义的字符出现在向量块内的每个位置 */
+TEST(JsonEscapeExtTest, EveryPosition)
+{
+    const char specials[] = {'"', '\\', '\n', '\x01', '\x1F', '\t', '\0'};
+
+    for (const char special : specials) {
+        for (std::size_t len = 1U; len < 80U; ++len) {
+            for (std::size_t pos = 0U; pos < len; ++pos) {
+                std::string str(len, 'v');
+                str[pos] = special;
+                ASSERT_EQ(ext_json_escape(str), json_escape(str))
+                    << "special = " << static_cast<int>(special) << ", len = " << len << ", pos = " << pos;
+            }
+        }
+    }
+}
+
+/* 所有单字节值与参考实现一致 */
+TEST(JsonEscapeExtTest, AllBytes)
+{
+    std::string str;
+
+    for (int c = 0; c < 256; ++c) {
+        str += static_cast<char>(c);
+    }
+
+    EXPECT_EQ(ext_json_escape(str), json_escape(str));
+}
+
+/*----------------------------------------------------------*/
+/* nva_formatJsonArgs：由键名与类型化的参数生成 JSON 对象        */
+TEST(JsonArgsTest, Types)
+{
+    char dst[256] = {0};
+
+    const char* const level = "info";
+    const int code = -42;
+    const unsigned int count = 7U;
+    const double ratio = 2.5;
+    const char flag = 'y';
+    const char* const msg = "done";
+    const char* const keys[] = {"level", "code", "count", "ratio", "flag", "msg"};
+    const nva_TypeId types[] = {NVA_TYPEID_STR,
+                                NVA_TYPEID_SINT,
+                                NVA_TYPEID_UINT,
+                                NVA_TYPEID_DOUBLE,
+                                NVA_TYPEID_CHAR,
+                                NVA_TYPEID_STR};
+    const void* const values[] = {&level, &code, &count, &ratio, &flag, &msg};
+    NVA_TEST_JSON_ARGS(dst,
+                       keys,
+                       types,
+                       values,
+                       "{\"level\":\"info\",\"code\":-42,\"count\":7,\"ratio\":2.5,\"flag\":\"y\",\"msg\":\"done\"}");
+
+    const unsigned long long id = 18446744073709551615ULL;
+    const char* const one[] = {"id"};
+    const nva_TypeId one_types[] = {NVA_TYPEID_ULLONG};
+    const void* const one_values[] = {&id};
+    NVA_TEST_JSON_ARGS(dst, one, one_types, one_values, "{\"id\":18446744073709551615}");
+
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), nullptr, nullptr, nullptr, 0U), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "{}");
+}
+
+TEST(JsonArgsTest, EscapesKeysAndValues)
+{
+    char dst[256] = {0};
+
+    const char* const path = "C:\\log";
+    const int one = 1;
+    const char* const keys[] = {"path", "quote\"key"};
+    const nva_TypeId types[] = {NVA_TYPEID_STR, NVA_TYPEID_SINT};
+    const void* const values[] = {&path, &one};
+    NVA_TEST_JSON_ARGS(dst, keys, types, values, "{\"path\":\"C:\\\\log\",\"quote\\\"key\":1}");
+
+#ifdef UNIT_TEST_HAS_STRN
+    const nva_StrView text = {"line1\nline2\t\"x\"!!", 15U};
+    const char* const text_keys[] = {"text"};
+    const nva_TypeId text_types[] = {NVA_TYPEID_STRN};
+    const void* const text_values[] = {&text};
+    NVA_TEST_JSON_ARGS(dst, text_keys, text_types, text_values, "{\"text\":\"line1\\nline2\\t\\\"x\\\"\"}");
+#endif /* UNIT_TEST_HAS_STRN */
+}
+
+/* 按 cap 检查剩余空间：恰好放下时成功，少一个字节时返回 NVA_FAIL 且 dst 为空字符串 */
+TEST(JsonArgsTest, Capacity)
+{
+    const char* const msg = "a\"b\n";
+    const int code = -7;
+    const double ratio = 0.25;
+    const char* const keys[] = {"msg", "code", "ratio"};
+    const nva_TypeId types[] = {NVA_TYPEID_STR, NVA_TYPEID_SINT, NVA_TYPEID_DOUBLE};
+    const void* const values[] = {&msg, &code, &ratio};
+    const std::string expect = "{\"msg\":\"a\\\"b\\n\",\"code\":-7,\"ratio\":0.25}";
+
+    for (std::size_t cap = 1U; cap <= expect.size() + 1U; ++cap) {
+        std::string dst(cap, '#');
+        const nva_ErrorCode result = nva_formatJsonArgs(&dst[0], cap, keys, types, values, 3U);
+
+        if (cap == expect.size() + 1U) {
+            ASSERT_EQ(result, NVA_SUCCESS);
+            EXPECT_STREQ(dst.c_str(), expect.c_str());
+        }
+        else {
+            ASSERT_EQ(result, NVA_FAIL) << "cap = " << cap;
+            EXPECT_EQ(dst[0], '\0') << "cap = " << cap;
+        }
+    }
+
+    char dst[8] = {'#'};
+    EXPECT_EQ(nva_formatJsonArgs(dst, 0U, keys, types, values, 3U), NVA_PARAM_ERROR);
+    EXPECT_EQ(dst[0], '#');
+}
+
+/* 非有限的浮点数没有 JSON 表示，输出 null */
+TEST(JsonArgsTest, NonFinite)
+{
+    char dst[128] = {0};
+
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::nan("");
+    const float ninf = -std::numeric_limits<float>::infinity();
+    const double ok = -0.5;
+    const char* const keys[] = {"inf", "nan", "ninf", "ok"};
+    const nva_TypeId types[] = {NVA_TYPEID_DOUBLE, NVA_TYPEID_DOUBLE, NVA_TYPEID_FLOAT, NVA_TYPEID_DOUBLE};
+    const void* const values[] = {&inf, &nan, &ninf, &ok};
+    NVA_TEST_JSON_ARGS(dst, keys, types, values, "{\"inf\":null,\"nan\":null,\"ninf\":null,\"ok\":-0.5}");
+}
+
+TEST(JsonArgsTest, Errors)
+{
+    char dst[128] = {0};
+
+    const int value = 1;
+    const char* const keys[] = {"a"};
+    const nva_TypeId types[] = {NVA_TYPEID_SINT};
+    const nva_TypeId unknown[] = {static_cast<nva_TypeId>(0x7F)};
+    const void* const values[] = {&value};
+    const void* const null_values[] = {nullptr};
+    const char* const null_keys[] = {nullptr};
+
+    EXPECT_EQ(nva_formatJsonArgs(nullptr, sizeof(dst), keys, types, values, 1U), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), keys, nullptr, values, 1U), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), keys, types, nullptr, 1U), NVA_PARAM_ERROR);
+
+    // 除 dst 本身无效外，失败时 dst 都是空字符串
+    dst[0] = '#';
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), nullptr, types, values, 1U), NVA_PARAM_ERROR);
+    EXPECT_STREQ(dst, "");
+    dst[0] = '#';
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), null_keys, types, values, 1U), NVA_PARAM_ERROR);
+    EXPECT_STREQ(dst, "");
+    dst[0] = '#';
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), keys, types, null_values, 1U), NVA_PARAM_ERROR);
+    EXPECT_STREQ(dst, "");
+
+    // 不支持的类型ID
+    EXPECT_EQ(nva_formatJsonArgs(dst, sizeof(dst), keys, unknown, values, 1U), NVA_FAIL);
+    EXPECT_STREQ(dst, "");
+
+    // 失败之后参数栈被清空，后续调用不受影响
+    NVA_TEST_JSON_ARGS(dst, keys, types, values, "{\"a\":1}");
+}
+
+/* 与先转义再 nva_format 两遍的做法结果相同 */
+TEST(JsonArgsTest, SameAsTwoPass)
+{
+    char dst[512] = {0};
+    char two_pass[512] = {0};
+    const std::string msg = "user \"root\" logged in from C:\\Users\n\x02";
+
+    const unsigned long ts = 1760832000UL;
+    const char* const msg_ptr = msg.c_str();
+    const char* const keys[] = {"ts", "msg"};
+    const nva_TypeId types[] = {NVA_TYPEID_ULONG, NVA_TYPEID_STR};
+    const void* const values[] = {&ts, &msg_ptr};
+    ASSERT_EQ(nva_formatJsonArgs(dst, sizeof(dst), keys, types, values, 2U), NVA_SUCCESS);
+
+    const std::string escaped = json_escape(msg);
+    ASSERT_EQ(nva_format(two_pass, "{{\"ts\":{},\"msg\":\"{}\"}}", nva_ulong(ts, nva_str(escaped.c_str(), NVA_START))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(dst, two_pass);
+}
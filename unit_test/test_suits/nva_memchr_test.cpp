@@ -0,0 +1,185 @@
+/**
+ * @file nva_memchr_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 对 nva_memchr 与 nva_memchr2 更详细的测试：逐字长/向量查找的对齐、命中位置与页边界
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+#include "nva/string.h"
+#include "nva/ext/string.h"
+#include "guard_page.h"
+
+#define MEMCHR  nva_memchr
+#define MEMCHR2 nva_memchr2
+
+/*----------------------------------------------------------*/
+/* 与 libc 的结果对照                                          */
+TEST(MemchrTest, SameAsLibc)
+{
+    const char str[] = "Hello, {name}! {{}}";
+    const std::size_t len = sizeof(str) - 1U;
+
+    for (const int c : {'H', 'o', '{', '}', '!', 'z', '\0'}) {
+        EXPECT_EQ(MEMCHR(str, c, len), std::memchr(str, c, len)) << "c = " << static_cast<char>(c);
+    }
+    EXPECT_EQ(MEMCHR(str, '\0', sizeof(str)), str + len);
+    EXPECT_EQ(MEMCHR(str, 'H', 0U), nullptr);
+    EXPECT_EQ(MEMCHR(nullptr, 'H', 0U), nullptr);
+}
+
+/* 所有起始对齐 × 命中位置，命中字节之后还有相同的字节 */
+TEST(MemchrTest, EveryAlignmentAndPosition)
+{
+    alignas(64) uint8_t buf[64 + 200 + 64];
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t pos = 0U; pos < 200U; ++pos) {
+            std::memset(buf, 'a', sizeof(buf));
+            buf[align + pos] = '{';
+            buf[align + pos + 1U] = '{';
+
+            ASSERT_EQ(MEMCHR(buf + align, '{', 200U), buf + align + pos) << "align = " << align << ", pos = " << pos;
+            // 长度恰好不包含命中字节
+            ASSERT_EQ(MEMCHR(buf + align, '{', pos), nullptr) << "align = " << align << ", pos = " << pos;
+        }
+    }
+}
+
+/* 长度之外的字节不能被当作命中 */
+TEST(MemchrTest, NotBeyondLength)
+{
+    alignas(64) uint8_t buf[128];
+    std::memset(buf, '{', sizeof(buf));
+
+    for (std::size_t align = 0U; align < 16U; ++align) {
+        for (std::size_t len = 0U; len < 64U; ++len) {
+            std::memset(buf + align, 'x', len);
+            ASSERT_EQ(MEMCHR(buf + align, '{', len), nullptr) << "align = " << align << ", len = " << len;
+            std::memset(buf + align, '{', len);
+        }
+    }
+}
+
+/* 按 unsigned char 比较；has-zero-byte 技巧中容易误判的字节 */
+TEST(MemchrTest, HighBitBytes)
+{
+    const uint8_t patterns[] = {0x00U, 0x01U, 0x7FU, 0x80U, 0x81U, 0xFEU, 0xFFU};
+    alignas(16) uint8_t buf[64];
+
+    for (const uint8_t fill : patterns) {
+        for (const uint8_t target : patterns) {
+            if (fill == target) continue;
+            for (std::size_t pos = 0U; pos < 40U; ++pos) {
+                std::memset(buf, fill, sizeof(buf));
+                buf[pos] = target;
+                ASSERT_EQ(MEMCHR(buf, target, sizeof(buf)), buf + pos)
+                    << "fill = " << static_cast<int>(fill) << ", target = " << static_cast<int>(target);
+            }
+        }
+    }
+
+    // c 先转换为 unsigned char
+    std::memset(buf, 0, sizeof(buf));
+    buf[9] = 0xFFU;
+    EXPECT_EQ(MEMCHR(buf, -1, sizeof(buf)), buf + 9);
+    EXPECT_EQ(MEMCHR(buf, 0x1FF, sizeof(buf)), buf + 9);
+}
+
+/* 页边界：查找区域以保护页结束，未命中时不能越界读取 */
+TEST(MemchrTest, EndsAtPageBoundary)
+{
+    GuardPage page{4096U};
+
+    for (std::size_t len = 0U; len < 300U; ++len) {
+        uint8_t* const buf = page.end() - len;
+        std::memset(buf, 'a', len);
+        ASSERT_EQ(MEMCHR(buf, '}', len), nullptr) << "len = " << len;
+
+        if (len > 0U) {
+            buf[len - 1U] = '}';
+            ASSERT_EQ(MEMCHR(buf, '}', len), buf + len - 1U) << "len = " << len;
+        }
+    }
+
+    for (std::size_t offset = 0U; offset < 64U; ++offset) {
+        std::memset(page.begin(), 'a', 128U);
+        ASSERT_EQ(MEMCHR(page.begin() + offset, '}', 64U), nullptr) << "offset = " << offset;
+    }
+}
+
+TEST(MemchrTest, Large16M)
+{
+    std::vector<uint8_t> buf(16 * 1024 * 1024 + 7, 'a');
+    EXPECT_EQ(MEMCHR(buf.data() + 1, '{', buf.size() - 1), nullptr);
+    buf[buf.size() - 2] = '{';
+    EXPECT_EQ(MEMCHR(buf.data() + 1, '{', buf.size() - 1), buf.data() + buf.size() - 2);
+}
+
+/*----------------------------------------------------------*/
+/* nva_memchr2：查找两个字节中先出现的一个（如 '{' 与 '}'）          */
+TEST(Memchr2Test, FirstOfEither)
+{
+    const char str[] = "value = {} and {{escaped}}";
+    const std::size_t len = sizeof(str) - 1U;
+
+    EXPECT_EQ(MEMCHR2(str, '{', '}', len), std::strchr(str, '{'));
+    EXPECT_EQ(MEMCHR2(str, '}', '{', len), std::strchr(str, '{'));
+    EXPECT_EQ(MEMCHR2(str + 9, '{', '}', len - 9U), str + 9);
+    EXPECT_EQ(MEMCHR2(str, 'x', 'y', len), nullptr);
+    EXPECT_EQ(MEMCHR2(str, '{', '{', len), std::strchr(str, '{'));  // 两个字节相同时等同于 nva_memchr
+    EXPECT_EQ(MEMCHR2(str, '{', '}', 0U), nullptr);
+    EXPECT_EQ(MEMCHR2(nullptr, '{', '}', 0U), nullptr);
+}
+
+TEST(Memchr2Test, EveryAlignmentAndPosition)
+{
+    alignas(64) uint8_t buf[64 + 200 + 64];
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t pos = 0U; pos < 200U; ++pos) {
+            std::memset(buf, 'a', sizeof(buf));
+            const uint8_t first = (pos % 2U == 0U) ? '{' : '}';
+            const uint8_t second = (pos % 2U == 0U) ? '}' : '{';
+            buf[align + pos] = first;
+            buf[align + pos + 1U] = second;
+
+            ASSERT_EQ(MEMCHR2(buf + align, '{', '}', 200U), buf + align + pos)
+                << "align = " << align << ", pos = " << pos;
+            ASSERT_EQ(MEMCHR2(buf + align, '{', '}', pos), nullptr) << "align = " << align << ", pos = " << pos;
+        }
+    }
+}
+
+TEST(Memchr2Test, EndsAtPageBoundary)
+{
+    GuardPage page{4096U};
+
+    for (std::size_t len = 0U; len < 300U; ++len) {
+        uint8_t* const buf = page.end() - len;
+        std::memset(buf, 'a', len);
+        ASSERT_EQ(MEMCHR2(buf, '{', '}', len), nullptr) << "len = " << len;
+
+        if (len > 0U) {
+            buf[len - 1U] = '}';
+            ASSERT_EQ(MEMCHR2(buf, '{', '}', len), buf + len - 1U) << "len = " << len;
+        }
+    }
+}
+
+TEST(Memchr2Test, HighBitBytes)
+{
+    alignas(16) uint8_t buf[64];
+    std::memset(buf, 0x80, sizeof(buf));
+    buf[33] = 0xFFU;
+    buf[40] = 0x7FU;
+
+    EXPECT_EQ(MEMCHR2(buf, 0x7F, -1, sizeof(buf)), buf + 33);
+    EXPECT_EQ(MEMCHR2(buf, 0x7F, 0x01, sizeof(buf)), buf + 40);
+    EXPECT_EQ(MEMCHR2(buf, 0x00, 0x01, sizeof(buf)), nullptr);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file nva_memcmp_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 对 nva_memcmp 更详细的测试：逐字长/向量比较的对齐、首个差异位置与页边界
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+#include "nva/ext/string.h"
+#include "guard_page.h"
+
+#define MEMCMP nva_memcmp
+
+/*----------------------------------------------------------*/
+/* 辅助函数与 fixture                                         */
+static void fill_seq(uint8_t* buf, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        buf[i] = static_cast<uint8_t>(i & 0xFF);
+    }
+}
+
+/* 只比较符号，返回 -1、0、1 */
+static int sign_of(const int value)
+{
+    return (value > 0) - (value < 0);
+}
+
+class MemcmpTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t kMax = 4096;
+    alignas(64) uint8_t lhs[kMax]{};
+    alignas(64) uint8_t rhs[kMax]{};
+
+    void SetUp() override
+    {
+        fill_seq(lhs, kMax);
+        fill_seq(rhs, kMax);
+    }
+};
+
+/*----------------------------------------------------------*/
+/* 零长度、相等的缓冲区                                        */
+TEST_F(MemcmpTest, ZeroLength)
+{
+    rhs[0] = 0xFFU;
+    EXPECT_EQ(MEMCMP(lhs, rhs, 0), 0);
+    EXPECT_EQ(MEMCMP(nullptr, nullptr, 0), 0);
+}
+TEST_F(MemcmpTest, SameBuffer)
+{
+    EXPECT_EQ(MEMCMP(lhs, lhs, kMax), 0);
+}
+TEST_F(MemcmpTest, EqualSizes)
+{
+    for (const size_t size : {1U, 2U, 3U, 4U, 7U, 8U, 15U, 16U, 31U, 32U, 63U, 64U, 127U, 129U, 1000U, 4095U, 4096U}) {
+        ASSERT_EQ(MEMCMP(lhs, rhs, size), 0) << "size = " << size;
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 与 nva_memcpy_test.cpp 相同的对齐组合                        */
+TEST_F(MemcmpTest, EveryAlignmentAndLength)
+{
+    for (size_t lhs_off = 0U; lhs_off < 16U; ++lhs_off) {
+        for (size_t rhs_off = 0U; rhs_off < 16U; ++rhs_off) {
+            for (size_t len = 0U; len <= 200U; ++len) {
+                std::memcpy(rhs + rhs_off, lhs + lhs_off, len);
+                ASSERT_EQ(MEMCMP(lhs + lhs_off, rhs + rhs_off, len), 0)
+                    << "lhs_off = " << lhs_off << ", rhs_off = " << rhs_off << ", len = " << len;
+            }
+        }
+    }
+}
+TEST_F(MemcmpTest, SrcUnalignedDstAligned)
+{
+    std::memcpy(rhs + 1, lhs + 3, 64);
+    EXPECT_EQ(MEMCMP(rhs + 1, lhs + 3, 64), 0);
+}
+TEST_F(MemcmpTest, BothUnaligned)
+{
+    std::memcpy(rhs + 5, lhs + 7, 128);
+    EXPECT_EQ(MEMCMP(rhs + 5, lhs + 7, 128), 0);
+    rhs[5 + 127] ^= 0x01U;
+    EXPECT_NE(MEMCMP(rhs + 5, lhs + 7, 128), 0);
+}
+
+/*----------------------------------------------------------*/
+/* 首个差异出现在每个位置，之后的字节与结果无关                   */
+TEST_F(MemcmpTest, DifferenceAtEveryPosition)
+{
+    for (size_t off = 0U; off < 8U; ++off) {
+        for (size_t pos = 0U; pos < 130U; ++pos) {
+            SetUp();
+            rhs[off + pos] = static_cast<uint8_t>(lhs[off + pos] + 1U);
+            // 差异之后的字节方向相反，只有第一个差异决定结果
+            for (size_t i = off + pos + 1U; i < off + 130U; ++i) {
+                rhs[i] = static_cast<uint8_t>(lhs[i] - 1U);
+            }
+
+            const int expect = sign_of(std::memcmp(lhs + off, rhs + off, 130U));
+            ASSERT_EQ(sign_of(MEMCMP(lhs + off, rhs + off, 130U)), expect) << "off = " << off << ", pos = " << pos;
+            ASSERT_EQ(sign_of(MEMCMP(rhs + off, lhs + off, 130U)), -expect) << "off = " << off << ", pos = " << pos;
+
+            // 长度不包含差异时相等
+            ASSERT_EQ(MEMCMP(lhs + off, rhs + off, pos), 0) << "off = " << off << ", pos = " << pos;
+        }
+    }
+}
+
+/* 按无符号字节比较：0x80 大于 0x7F，且字内的字节序不能影响结果 */
+TEST_F(MemcmpTest, UnsignedBytes)
+{
+    const uint8_t a[] = {0x00U, 0x80U};
+    const uint8_t b[] = {0x00U, 0x7FU};
+    EXPECT_GT(MEMCMP(a, b, 2), 0);
+    EXPECT_LT(MEMCMP(b, a, 2), 0);
+
+    // 小端序下整字比较会得到相反的结果
+    const uint8_t c[8] = {0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U};
+    const uint8_t d[8] = {0x00U, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U};
+    EXPECT_GT(MEMCMP(c, d, 8), 0);
+    EXPECT_LT(MEMCMP(d, c, 8), 0);
+
+    const uint8_t high[16] = {0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+                              0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFEU};
+    const uint8_t all[16] = {0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+                             0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU};
+    EXPECT_LT(MEMCMP(high, all, 16), 0);
+    EXPECT_GT(MEMCMP(all, high, 16), 0);
+}
+
+/*----------------------------------------------------------*/
+/* 页边界：比较区域以后保护页结束，或从前保护页之后开始            */
+TEST(MemcmpPageTest, EndsAtPageBoundary)
+{
+    GuardPage page_a{4096U};
+    GuardPage page_b{4096U};
+
+    for (size_t len = 0U; len < 300U; ++len) {
+        uint8_t* const a = page_a.end() - len;
+        uint8_t* const b = page_b.end() - len;
+        fill_seq(a, len);
+        fill_seq(b, len);
+        ASSERT_EQ(MEMCMP(a, b, len), 0) << "len = " << len;
+
+        if (len > 0U) {
+            b[len - 1U] ^= 0x80U;
+            ASSERT_EQ(sign_of(MEMCMP(a, b, len)), sign_of(std::memcmp(a, b, len))) << "len = " << len;
+        }
+    }
+
+    // 两侧错位不同，其中一侧的末尾先碰到保护页
+    for (size_t off = 1U; off < 16U; ++off) {
+        uint8_t* const a = page_a.end() - 64U;
+        uint8_t* const b = page_b.end() - 64U - off;
+        std::memset(a, 0x5A, 64U);
+        std::memset(b, 0x5A, 64U + off);
+        ASSERT_EQ(MEMCMP(a, b, 64U), 0) << "off = " << off;
+        ASSERT_EQ(MEMCMP(b + off, a, 64U), 0) << "off = " << off;
+    }
+}
+TEST(MemcmpPageTest, StartsAtPageBoundary)
+{
+    GuardPage page_a{4096U};
+    GuardPage page_b{4096U};
+
+    for (size_t off = 0U; off < 64U; ++off) {
+        for (const size_t len : {1U, 7U, 8U, 15U, 16U, 31U, 32U, 63U, 64U, 100U}) {
+            fill_seq(page_a.begin(), off + len);
+            std::memcpy(page_b.begin(), page_a.begin() + off, len);
+            ASSERT_EQ(MEMCMP(page_a.begin() + off, page_b.begin(), len), 0) << "off = " << off << ", len = " << len;
+        }
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 大尺寸：差异位于末尾                                        */
+TEST(MemcmpLargeTest, Large16M)
+{
+    std::vector<uint8_t> a(16 * 1024 * 1024 + 7);
+    fill_seq(a.data(), a.size());
+    std::vector<uint8_t> b = a;
+
+    EXPECT_EQ(MEMCMP(a.data() + 1, b.data() + 1, a.size() - 1), 0);
+    b.back() = static_cast<uint8_t>(b.back() + 1U);
+    EXPECT_LT(MEMCMP(a.data() + 1, b.data() + 1, a.size() - 1), 0);
+    EXPECT_EQ(MEMCMP(a.data() + 1, b.data() + 1, a.size() - 2), 0);
+}
@@ -15,6 +15,7 @@
 #include "gtest_extend_message_types.hpp"
 
 #include "nva/string.h"
+#include "nva/ext/string.h"
 
 #define MEMCPY nva_memcpy
 
@@ -357,3 +358,115 @@ TEST_F(MemcpyTest, StressAllBytes)
     MEMCPY(out, all, 256);
     EXPECT_TRUE(buffers_equal(out, all, 256));
 }
+
+/*----------------------------------------------------------*/
+/* 51~55：NVA_MEMCPY_CONST，常量尺寸的单次非对齐读写              */
+TEST_F(MemcpyTest, ConstBoundaryU8)
+{
+    uint8_t a = 0xAB, b;
+    NVA_MEMCPY_CONST(&b, &a, 1);
+    EXPECT_EQ(b, 0xAB);
+}
+TEST_F(MemcpyTest, ConstBoundaryU16)
+{
+    uint16_t a = 0xDEAD, b;
+    NVA_MEMCPY_CONST(&b, &a, 2);
+    EXPECT_EQ(b, 0xDEAD);
+}
+TEST_F(MemcpyTest, ConstBoundaryU32)
+{
+    uint32_t a = 0xCAFEBABE, b;
+    NVA_MEMCPY_CONST(&b, &a, 4);
+    EXPECT_EQ(b, 0xCAFEBABE);
+}
+TEST_F(MemcpyTest, ConstBoundaryU64)
+{
+    uint64_t a = 0x0123456789ABCDEFULL, b;
+    NVA_MEMCPY_CONST(&b, &a, 8);
+    EXPECT_EQ(b, 0x0123456789ABCDEFULL);
+}
+TEST_F(MemcpyTest, ConstBoundary128Bit)
+{
+    alignas(16) uint8_t a[16] = {0};
+    alignas(16) uint8_t b[16];
+    fill_seq(a, 16);
+    NVA_MEMCPY_CONST(b, a, 16);
+    EXPECT_TRUE(buffers_equal(a, b, 16));
+}
+
+/* 56~60：NVA_MEMCPY_CONST 的非对齐地址、其他尺寸与语句形式        */
+TEST_F(MemcpyTest, ConstUnaligned)
+{
+#define NVA_TEST_MEMCPY_CONST_AT(n)                                                         \
+    for (size_t src_off = 0; src_off < 16; ++src_off) {                                     \
+        for (size_t dst_off = 0; dst_off < 16; ++dst_off) {                                 \
+            std::memset(dst, 0xAA, 64);                                                     \
+            NVA_MEMCPY_CONST(dst + dst_off, src + src_off, n);                              \
+            ASSERT_TRUE(buffers_equal(dst + dst_off, src + src_off, n))                     \
+                << "n = " << (n) << ", src_off = " << src_off << ", dst_off = " << dst_off; \
+            ASSERT_EQ(dst[dst_off + (n)], 0xAA) << "n = " << (n);                           \
+        }                                                                                   \
+    }
+
+    NVA_TEST_MEMCPY_CONST_AT(1);
+    NVA_TEST_MEMCPY_CONST_AT(2);
+    NVA_TEST_MEMCPY_CONST_AT(4);
+    NVA_TEST_MEMCPY_CONST_AT(8);
+    NVA_TEST_MEMCPY_CONST_AT(16);
+
+#undef NVA_TEST_MEMCPY_CONST_AT
+}
+TEST_F(MemcpyTest, ConstOtherSizes)
+{
+    // 不在 {1, 2, 4, 8, 16} 中的尺寸退化为 nva_memcpy
+    NVA_MEMCPY_CONST(dst + 1, src + 3, 3);
+    EXPECT_TRUE(buffers_equal(dst + 1, src + 3, 3));
+    NVA_MEMCPY_CONST(dst + 5, src + 2, 12);
+    EXPECT_TRUE(buffers_equal(dst + 5, src + 2, 12));
+    NVA_MEMCPY_CONST(dst + 7, src + 1, 32);
+    EXPECT_TRUE(buffers_equal(dst + 7, src + 1, 32));
+    NVA_MEMCPY_CONST(dst + 64, src, 100);
+    EXPECT_TRUE(buffers_equal(dst + 64, src, 100));
+
+    EXPECT_NO_FATAL_FAILURE(NVA_MEMCPY_CONST(dst, src, 0));
+}
+TEST_F(MemcpyTest, ConstStackTypes)
+{
+    // 与 nva_Stack 压入/取出时的类型尺寸一致，源与目的都不对齐
+    const double d = -2.5;
+    const void* const p = &d;
+    const long long ll = -0x123456789LL;
+    double d_out;
+    const void* p_out;
+    long long ll_out;
+
+    NVA_MEMCPY_CONST(dst + 3, &d, sizeof(double));
+    NVA_MEMCPY_CONST(&d_out, dst + 3, sizeof(double));
+    EXPECT_EQ(d_out, d);
+
+    NVA_MEMCPY_CONST(dst + 5, &p, sizeof(void*));
+    NVA_MEMCPY_CONST(&p_out, dst + 5, sizeof(void*));
+    EXPECT_EQ(p_out, p);
+
+    NVA_MEMCPY_CONST(dst + 1, &ll, sizeof(long long));
+    NVA_MEMCPY_CONST(&ll_out, dst + 1, sizeof(long long));
+    EXPECT_EQ(ll_out, ll);
+}
+TEST_F(MemcpyTest, ConstSingleStatement)
+{
+    // 可以作为不带花括号的 if/else 分支
+    uint32_t a = 0x11223344U, b = 0U;
+    if (a != 0U)
+        NVA_MEMCPY_CONST(&b, &a, 4);
+    else
+        NVA_MEMCPY_CONST(&b, &a, 2);
+    EXPECT_EQ(b, 0x11223344U);
+
+    // 参数只求值一次
+    const uint8_t* s = src;
+    uint8_t* d = dst;
+    NVA_MEMCPY_CONST(d++, s++, 8);
+    EXPECT_EQ(d, dst + 1);
+    EXPECT_EQ(s, src + 1);
+    EXPECT_TRUE(buffers_equal(dst, src, 8));
+}
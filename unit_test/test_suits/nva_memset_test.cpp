@@ -0,0 +1,128 @@
+/**
+ * @file nva_memset_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 对 nva_memset 更详细的测试：逐字长/向量写入的对齐主体与首尾
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+#include "nva/string.h"
+#include "nva/ext/string.h"
+
+#define MEMSET nva_memset
+
+/*----------------------------------------------------------*/
+/* 辅助函数与 fixture                                         */
+static bool all_equal(const uint8_t* buf, const size_t len, const uint8_t value)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (buf[i] != value) return false;
+    }
+    return true;
+}
+
+class MemsetTest : public ::testing::Test
+{
+protected:
+    static constexpr size_t kMax = 4096;
+    alignas(64) uint8_t dst[kMax + 64]{};
+
+    void SetUp() override
+    {
+        std::memset(dst, 0xAA, sizeof(dst));  // 填充 0xAA，方便发现越界
+    }
+
+    /* [off, off + len) 为 value，两侧保持 0xAA */
+    bool filled(const size_t off, const size_t len, const uint8_t value) const
+    {
+        return all_equal(dst, off, 0xAA) && all_equal(dst + off, len, value) &&
+               all_equal(dst + off + len, sizeof(dst) - off - len, 0xAA);
+    }
+};
+
+/*----------------------------------------------------------*/
+/* 1~5：零长度、小尺寸、返回值                                   */
+TEST_F(MemsetTest, ZeroLength)
+{
+    EXPECT_EQ(MEMSET(dst, 0, 0), dst);
+    EXPECT_TRUE(filled(0, 0, 0));
+    EXPECT_NO_FATAL_FAILURE(MEMSET(nullptr, 0, 0));
+}
+TEST_F(MemsetTest, SmallSizes)
+{
+    for (const size_t len : {1U, 2U, 3U, 4U, 7U, 8U, 15U, 16U, 31U, 32U, 33U}) {
+        SetUp();
+        EXPECT_EQ(MEMSET(dst, 0x5C, len), dst);
+        ASSERT_TRUE(filled(0, len, 0x5C)) << "len = " << len;
+    }
+}
+TEST_F(MemsetTest, PageSize)
+{
+    MEMSET(dst, 0, 4096);
+    EXPECT_TRUE(filled(0, 4096, 0));
+}
+TEST_F(MemsetTest, OddSize127)
+{
+    MEMSET(dst + 1, 0x11, 127);
+    EXPECT_TRUE(filled(1, 127, 0x11));
+}
+
+/* 只使用 value 的低 8 位 */
+TEST_F(MemsetTest, ValueTruncated)
+{
+    MEMSET(dst, 0x1FF, 16);
+    EXPECT_TRUE(filled(0, 16, 0xFF));
+    MEMSET(dst, -1, 16);
+    EXPECT_TRUE(filled(0, 16, 0xFF));
+    MEMSET(dst, 0x180, 16);
+    EXPECT_TRUE(filled(0, 16, 0x80));
+}
+
+/*----------------------------------------------------------*/
+/* 6~8：所有起始对齐 × 长度，首尾不能多写                        */
+TEST_F(MemsetTest, EveryAlignmentAndLength)
+{
+    for (size_t off = 0; off < 64; ++off) {
+        for (size_t len = 0; len <= 300; ++len) {
+            SetUp();
+            MEMSET(dst + off, '*', len);
+            ASSERT_TRUE(filled(off, len, '*')) << "off = " << off << ", len = " << len;
+        }
+    }
+}
+TEST_F(MemsetTest, Misaligned64Bytes)
+{
+    MEMSET(dst + 2, 0x3C, 64);
+    EXPECT_TRUE(filled(2, 64, 0x3C));
+}
+TEST_F(MemsetTest, OverwriteTwice)
+{
+    MEMSET(dst + 3, 'a', 200);
+    MEMSET(dst + 50, 'b', 20);
+    EXPECT_TRUE(all_equal(dst + 3, 47, 'a'));
+    EXPECT_TRUE(all_equal(dst + 50, 20, 'b'));
+    EXPECT_TRUE(all_equal(dst + 70, 133, 'a'));
+}
+
+/*----------------------------------------------------------*/
+/* 9~10：大尺寸                                               */
+TEST_F(MemsetTest, Stress16M)
+{
+    std::vector<uint8_t> big(16 * 1024 * 1024 + 7, 0xAA);
+    MEMSET(big.data() + 3, 0x00, big.size() - 4);
+    EXPECT_EQ(big[2], 0xAA);
+    EXPECT_TRUE(all_equal(big.data() + 3, big.size() - 4, 0x00));
+    EXPECT_EQ(big.back(), 0xAA);
+}
+TEST_F(MemsetTest, AllValues)
+{
+    for (int value = 0; value < 256; ++value) {
+        MEMSET(dst + 5, value, 100);
+        ASSERT_TRUE(all_equal(dst + 5, 100, static_cast<uint8_t>(value))) << "value = " << value;
+    }
+}
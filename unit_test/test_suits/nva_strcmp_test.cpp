@@ -0,0 +1,174 @@
+/**
+ * @file nva_strcmp_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 对 nva_strcmp 更详细的测试：逐字长/向量比较在首个差异或 '\0' 处提前结束，且不越过页边界
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <string>
+
+#include "nva/string.h"
+#include "guard_page.h"
+
+#define STRCMP nva_strcmp
+
+/* 只比较符号，返回 -1、0、1 */
+static int sign_of(const int value)
+{
+    return (value > 0) - (value < 0);
+}
+
+/*----------------------------------------------------------*/
+/* 两侧起始对齐 × 长度，相等与末尾差异                          */
+TEST(StrcmpTest, EveryAlignmentAndLength)
+{
+    alignas(64) char lhs[16 + 200 + 2];
+    alignas(64) char rhs[16 + 200 + 2];
+
+    for (std::size_t lhs_off = 0U; lhs_off < 16U; ++lhs_off) {
+        for (std::size_t rhs_off = 0U; rhs_off < 16U; ++rhs_off) {
+            for (std::size_t len = 0U; len <= 200U; ++len) {
+                std::memset(lhs, 'k', sizeof(lhs));
+                std::memset(rhs, 'k', sizeof(rhs));
+                lhs[lhs_off + len] = '\0';
+                rhs[rhs_off + len] = '\0';
+                ASSERT_EQ(STRCMP(lhs + lhs_off, rhs + rhs_off), 0)
+                    << "lhs_off = " << lhs_off << ", rhs_off = " << rhs_off << ", len = " << len;
+
+                // 右侧多一个字符：左侧是右侧的前缀
+                rhs[rhs_off + len] = 'k';
+                rhs[rhs_off + len + 1U] = '\0';
+                ASSERT_LT(STRCMP(lhs + lhs_off, rhs + rhs_off), 0)
+                    << "lhs_off = " << lhs_off << ", rhs_off = " << rhs_off << ", len = " << len;
+                ASSERT_GT(STRCMP(rhs + rhs_off, lhs + lhs_off), 0)
+                    << "lhs_off = " << lhs_off << ", rhs_off = " << rhs_off << ", len = " << len;
+            }
+        }
+    }
+}
+
+/* 首个差异出现在块内每个位置，之后的字节方向相反 */
+TEST(StrcmpTest, DifferenceAtEveryPosition)
+{
+    alignas(64) char lhs[160];
+    alignas(64) char rhs[160];
+
+    for (std::size_t pos = 0U; pos < 130U; ++pos) {
+        std::memset(lhs, 'm', sizeof(lhs));
+        std::memset(rhs, 'm', sizeof(rhs));
+        lhs[150] = '\0';
+        rhs[150] = '\0';
+        rhs[pos] = 'n';
+        for (std::size_t i = pos + 1U; i < 150U; ++i) {
+            rhs[i] = 'a';
+        }
+
+        ASSERT_LT(STRCMP(lhs, rhs), 0) << "pos = " << pos;
+        ASSERT_GT(STRCMP(rhs, lhs), 0) << "pos = " << pos;
+    }
+}
+
+/* '\0' 之后的字节不参与比较 */
+TEST(StrcmpTest, StopsAtZero)
+{
+    alignas(64) char lhs[80];
+    alignas(64) char rhs[80];
+
+    for (std::size_t pos = 0U; pos < 64U; ++pos) {
+        std::memset(lhs, 'q', sizeof(lhs));
+        std::memset(rhs, 'q', sizeof(rhs));
+        lhs[pos] = '\0';
+        rhs[pos] = '\0';
+        lhs[pos + 1U] = 'A';
+        rhs[pos + 1U] = 'Z';
+        lhs[sizeof(lhs) - 1U] = '\0';
+        rhs[sizeof(rhs) - 1U] = '\0';
+
+        ASSERT_EQ(STRCMP(lhs, rhs), 0) << "pos = " << pos;
+    }
+}
+
+/* 按无符号字节比较：0x80 以上的字节大于 ASCII 字符 */
+TEST(StrcmpTest, UnsignedBytes)
+{
+    EXPECT_GT(STRCMP("\x80", "\x7F"), 0);
+    EXPECT_LT(STRCMP("a\x7F", "a\xFF"), 0);
+    EXPECT_GT(STRCMP("\xFF", ""), 0);
+
+    // 小端序下整字比较会得到相反的结果
+    EXPECT_GT(STRCMP("\x02\x01\x01\x01\x01\x01\x01\x01", "\x01\x02\x01\x01\x01\x01\x01\x01"), 0);
+    EXPECT_LT(STRCMP("\x01\xFF\x01\x01\x01\x01\x01\x01", "\x02\x01\x01\x01\x01\x01\x01\x01"), 0);
+
+    for (const char* const lhs : {"\x80", "\x81\x01", "\xFE\xFF", "\x01\x80"}) {
+        for (const char* const rhs : {"\x80", "\x7F", "\x01", "\xFF\xFF", "\x01\x80\x80"}) {
+            ASSERT_EQ(sign_of(STRCMP(lhs, rhs)), sign_of(std::strcmp(lhs, rhs)));
+        }
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 页边界：较短一侧的 '\0' 是保护页之前的最后一个字节             */
+TEST(StrcmpPageTest, EndsAtPageBoundary)
+{
+    GuardPage page_a{4096U};
+    GuardPage page_b{4096U};
+
+    for (std::size_t len = 0U; len < 300U; ++len) {
+        const char* const a = page_a.stringAtEnd(len, 'p');
+        const char* const b = page_b.stringAtEnd(len, 'p');
+        ASSERT_EQ(STRCMP(a, b), 0) << "len = " << len;
+
+        // 另一侧更长，比较必须停在较短一侧的 '\0' 上
+        const std::string longer(len + 64U, 'p');
+        ASSERT_LT(STRCMP(a, longer.c_str()), 0) << "len = " << len;
+        ASSERT_GT(STRCMP(longer.c_str(), a), 0) << "len = " << len;
+    }
+}
+
+/* 页边界：首个差异之后紧跟保护页，比较必须在差异处结束 */
+TEST(StrcmpPageTest, DifferenceBeforePageBoundary)
+{
+    GuardPage page{4096U};
+    char* const end = reinterpret_cast<char*>(page.end());
+
+    for (std::size_t len = 1U; len < 100U; ++len) {
+        char* const str = end - len;
+        std::memset(str, 'r', len);  // 没有 '\0'，最后一个字节即为差异
+
+        std::string other(len - 1U, 'r');
+        other += 's';
+        ASSERT_LT(STRCMP(str, other.c_str()), 0) << "len = " << len;
+        ASSERT_GT(STRCMP(other.c_str(), str), 0) << "len = " << len;
+    }
+}
+
+TEST(StrcmpPageTest, StartsAtPageBoundary)
+{
+    GuardPage page_a{4096U};
+    GuardPage page_b{4096U};
+
+    for (std::size_t offset = 0U; offset < 64U; ++offset) {
+        for (const std::size_t len : {0U, 1U, 7U, 8U, 15U, 16U, 31U, 32U, 63U, 64U, 100U}) {
+            char* const a = page_a.stringAtBegin(offset + len, 's');
+            char* const b = page_b.stringAtBegin(len, 's');
+            ASSERT_EQ(STRCMP(a + offset, b), 0) << "offset = " << offset << ", len = " << len;
+        }
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 长字符串：差异在末尾                                        */
+TEST(StrcmpTest, LongStrings)
+{
+    for (const std::size_t len : {1000U, 4095U, 4096U, 4097U, 65536U, 1000000U}) {
+        const std::string a(len, 'L');
+        std::string b = a;
+        ASSERT_EQ(STRCMP(a.c_str(), b.c_str()), 0);
+        b.back() = 'M';
+        ASSERT_LT(STRCMP(a.c_str(), b.c_str()), 0);
+    }
+}
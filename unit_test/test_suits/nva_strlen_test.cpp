@@ -0,0 +1,140 @@
+/**
+ * @file nva_strlen_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 对 nva_strlen 更详细的测试：逐字长/向量扫描的对齐、页边界与高位字节
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <string>
+
+#include "nva/string.h"
+#include "guard_page.h"
+
+#define STRLEN nva_strlen
+
+/*----------------------------------------------------------*/
+/* 与 StringTest.nva_strlen 相同的用例                        */
+TEST(StrlenTest, SameAsStringTest)
+{
+    EXPECT_EQ(STRLEN("Hello, World!"), 13);
+    EXPECT_EQ(STRLEN(""), 0);
+    EXPECT_EQ(STRLEN("This is a long string for testing."), 34);
+}
+
+/*----------------------------------------------------------*/
+/* 所有起始对齐 × 所有短长度                                   */
+TEST(StrlenTest, EveryAlignmentAndLength)
+{
+    alignas(64) char buf[64 + 300 + 1];
+
+    for (std::size_t align = 0U; align < 64U; ++align) {
+        for (std::size_t len = 0U; len <= 300U; ++len) {
+            std::memset(buf, 'x', sizeof(buf));
+            buf[align + len] = '\0';
+
+            ASSERT_EQ(STRLEN(buf + align), len) << "align = " << align << ", len = " << len;
+        }
+    }
+}
+
+/* 在一个 64 字节块中，'\0' 位于每个位置，且之后仍有非零字节 */
+TEST(StrlenTest, ZeroAtEveryPositionOfBlock)
+{
+    alignas(64) char buf[128];
+
+    for (std::size_t pos = 0U; pos < 64U; ++pos) {
+        std::memset(buf, 'y', sizeof(buf));
+        buf[pos] = '\0';
+        buf[sizeof(buf) - 1U] = '\0';
+
+        ASSERT_EQ(STRLEN(buf), pos);
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 高位字节：has-zero-byte 技巧中容易误判的 0x80、0x01、0xFF 组合 */
+TEST(StrlenTest, HighBitBytes)
+{
+    const unsigned char patterns[] = {0x80U, 0x81U, 0x01U, 0xFFU, 0x7FU, 0xFEU};
+    alignas(16) unsigned char buf[80];
+
+    for (const unsigned char a : patterns) {
+        for (const unsigned char b : patterns) {
+            for (std::size_t len = 0U; len < 40U; ++len) {
+                for (std::size_t i = 0U; i < len; ++i) {
+                    buf[i] = (i % 2U == 0U) ? a : b;
+                }
+                buf[len] = 0U;
+                std::memset(buf + len + 1U, 0x80, sizeof(buf) - len - 1U);
+
+                ASSERT_EQ(STRLEN(reinterpret_cast<const char*>(buf)), len)
+                    << "a = " << static_cast<int>(a) << ", b = " << static_cast<int>(b) << ", len = " << len;
+            }
+        }
+    }
+
+    // 0x0100 与 0x8080 这样的相邻字节，低字节借位可能影响高字节
+    const unsigned char borrow[] = {0x01U, 0x01U, 0x80U, 0x01U, 0x00U, 0x80U, 0x80U, 0x80U, 0x00U};
+    EXPECT_EQ(STRLEN(reinterpret_cast<const char*>(borrow)), 4U);
+}
+
+/*----------------------------------------------------------*/
+/* 页边界：结尾的 '\0' 是后保护页之前的最后一个字节              */
+TEST(StrlenTest, EndsAtPageBoundary)
+{
+    GuardPage page{8192U};
+
+    for (std::size_t len = 0U; len < 300U; ++len) {
+        ASSERT_EQ(STRLEN(page.stringAtEnd(len)), len) << "len = " << len;
+    }
+
+    for (const std::size_t len : {page.pageSize() - 1U, page.pageSize(), page.pageSize() + 1U, page.size() - 1U}) {
+        ASSERT_EQ(STRLEN(page.stringAtEnd(len)), len) << "len = " << len;
+    }
+}
+
+/* 页边界：字符串从前保护页之后的第一个字节开始，向下对齐的读取不能越过页首 */
+TEST(StrlenTest, StartsAtPageBoundary)
+{
+    GuardPage page{4096U};
+
+    for (std::size_t offset = 0U; offset < 64U; ++offset) {
+        for (const std::size_t len : {0U, 1U, 7U, 8U, 15U, 16U, 31U, 32U, 63U, 64U, 100U}) {
+            char* const str = page.stringAtBegin(offset + len);
+            ASSERT_EQ(STRLEN(str + offset), len) << "offset = " << offset << ", len = " << len;
+        }
+    }
+}
+
+/* 页边界：跨越中间页边界的字符串 */
+TEST(StrlenTest, CrossesPageBoundary)
+{
+    GuardPage page{3U * 4096U};
+    char* const base = reinterpret_cast<char*>(page.begin());
+
+    std::memset(base, 'z', page.size());
+    for (std::size_t start = page.pageSize() - 40U; start < page.pageSize(); ++start) {
+        for (std::size_t len = 0U; len < 80U; ++len) {
+            base[start + len] = '\0';
+            ASSERT_EQ(STRLEN(base + start), len) << "start = " << start << ", len = " << len;
+            base[start + len] = 'z';
+        }
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 几 KB 的长字符串（请求体、路径）                             */
+TEST(StrlenTest, LongStrings)
+{
+    for (const std::size_t len : {1000U, 4095U, 4096U, 4097U, 65536U, 1000000U}) {
+        const std::string str(len, 'L');
+        ASSERT_EQ(STRLEN(str.c_str()), len);
+    }
+
+    GuardPage page{1U << 20U};
+    EXPECT_EQ(STRLEN(page.stringAtEnd(page.size() - 1U)), page.size() - 1U);
+}
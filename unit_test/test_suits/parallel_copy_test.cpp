@@ -0,0 +1,179 @@
+/**
+ * @file parallel_copy_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 多线程 nva_memcpyParallel/nva_memmoveParallel 测试
+ *
+ * unit_test 的 CMakeLists.txt 为 nva_ext 将 NVA_PARALLEL_COPY_THRESHOLD 降低到 64 KiB，
+ * 使中等尺寸的用例也会被切分到多个线程。
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "nva/ext/string.h"
+
+/* 不同于 i & 0xFF 的序列，使错位一个块的拷贝也能被发现 */
+static void fill_pattern(uint8_t* buf, const size_t len, const uint32_t seed)
+{
+    uint32_t x = seed * 2654435761U + 1U;
+    for (size_t i = 0; i < len; ++i) {
+        x = x * 1664525U + 1013904223U;
+        buf[i] = static_cast<uint8_t>(x >> 24U);
+    }
+}
+
+static bool eq(const uint8_t* a, const uint8_t* b, const size_t n)
+{
+    return std::memcmp(a, b, n) == 0;
+}
+
+/* 0 表示使用默认线程数 */
+static const unsigned int kThreadCounts[] = {0U, 1U, 2U, 3U, 4U, 7U, 16U};
+
+/*----------------------------------------------------------*/
+/* 阈值附近与阈值以下的尺寸，结果与单线程版本一致                  */
+TEST(ParallelCopyTest, SizesAroundThreshold)
+{
+    constexpr size_t kThreshold = NVA_PARALLEL_COPY_THRESHOLD;
+    const size_t sizes[] = {0U, 1U, 4095U, kThreshold - 1U, kThreshold, kThreshold + 1U, 3U * kThreshold + 17U};
+
+    std::vector<uint8_t> src(4U * kThreshold);
+    std::vector<uint8_t> dst(4U * kThreshold);
+    fill_pattern(src.data(), src.size(), 1U);
+
+    for (const size_t size : sizes) {
+        for (const unsigned int threads : kThreadCounts) {
+            std::memset(dst.data(), 0xAA, dst.size());
+            EXPECT_EQ(nva_memcpyParallel(dst.data(), src.data(), size, threads), dst.data());
+            ASSERT_TRUE(eq(dst.data(), src.data(), size)) << "size = " << size << ", threads = " << threads;
+            // 不能写到 size 之后
+            ASSERT_EQ(dst[size], 0xAA) << "size = " << size << ", threads = " << threads;
+        }
+    }
+}
+
+TEST(ParallelCopyTest, Unaligned)
+{
+    constexpr size_t kSize = 1U << 20U;
+    std::vector<uint8_t> src(kSize + 16U);
+    std::vector<uint8_t> dst(kSize + 16U);
+    fill_pattern(src.data(), src.size(), 2U);
+
+    for (const size_t src_off : {0U, 1U, 3U, 7U}) {
+        for (const size_t dst_off : {0U, 1U, 5U, 8U}) {
+            const size_t len = kSize - src_off - dst_off + 3U;
+            std::memset(dst.data(), 0, dst.size());
+            nva_memcpyParallel(dst.data() + dst_off, src.data() + src_off, len, 4U);
+            ASSERT_TRUE(eq(dst.data() + dst_off, src.data() + src_off, len))
+                << "src_off = " << src_off << ", dst_off = " << dst_off;
+        }
+    }
+}
+
+// 仅测试无崩溃即可
+TEST(ParallelCopyTest, ZeroLength)
+{
+    EXPECT_EQ(nva_memcpyParallel(nullptr, nullptr, 0U, 4U), nullptr);
+    EXPECT_EQ(nva_memmoveParallel(nullptr, nullptr, 0U, 4U), nullptr);
+}
+
+/*----------------------------------------------------------*/
+/* 重叠移动：块的处理顺序必须保证尚未读取的源数据不被覆盖            */
+TEST(ParallelMoveTest, Overlap)
+{
+    constexpr size_t kSize = 1U << 20U;
+    std::vector<uint8_t> buffer(2U * kSize);
+    std::vector<uint8_t> golden(2U * kSize);
+
+    const size_t shifts[] = {1U, 63U, 4096U, NVA_PARALLEL_COPY_THRESHOLD - 1U, kSize / 3U, kSize / 2U, kSize - 1U};
+
+    for (const size_t shift : shifts) {
+        for (const unsigned int threads : kThreadCounts) {
+            // 目的地址在源地址之后（前向重叠）
+            fill_pattern(buffer.data(), buffer.size(), 3U);
+            golden = buffer;
+            std::memmove(golden.data() + shift, golden.data(), kSize);
+            EXPECT_EQ(nva_memmoveParallel(buffer.data() + shift, buffer.data(), kSize, threads), buffer.data() + shift);
+            ASSERT_TRUE(eq(buffer.data(), golden.data(), buffer.size()))
+                << "forward, shift = " << shift << ", threads = " << threads;
+
+            // 目的地址在源地址之前（后向重叠）
+            fill_pattern(buffer.data(), buffer.size(), 4U);
+            golden = buffer;
+            std::memmove(golden.data(), golden.data() + shift, kSize);
+            nva_memmoveParallel(buffer.data(), buffer.data() + shift, kSize, threads);
+            ASSERT_TRUE(eq(buffer.data(), golden.data(), buffer.size()))
+                << "backward, shift = " << shift << ", threads = " << threads;
+        }
+    }
+}
+
+TEST(ParallelMoveTest, SameAddressAndDisjoint)
+{
+    constexpr size_t kSize = 1U << 20U;
+    std::vector<uint8_t> buffer(2U * kSize);
+    fill_pattern(buffer.data(), buffer.size(), 5U);
+    const std::vector<uint8_t> golden = buffer;
+
+    nva_memmoveParallel(buffer.data(), buffer.data(), kSize, 4U);
+    EXPECT_TRUE(eq(buffer.data(), golden.data(), buffer.size()));
+
+    nva_memmoveParallel(buffer.data() + kSize, buffer.data(), kSize, 4U);
+    EXPECT_TRUE(eq(buffer.data() + kSize, golden.data(), kSize));
+}
+
+/*----------------------------------------------------------*/
+/* 多个调用者同时进行并行拷贝                                     */
+TEST(ParallelCopyTest, ConcurrentCallers)
+{
+    constexpr size_t kSize = 4U << 20U;
+    std::vector<std::vector<uint8_t>> src(4, std::vector<uint8_t>(kSize));
+    std::vector<std::vector<uint8_t>> dst(4, std::vector<uint8_t>(kSize));
+    std::vector<std::thread> callers;
+
+    for (size_t i = 0U; i < src.size(); ++i) {
+        fill_pattern(src[i].data(), kSize, static_cast<uint32_t>(10U + i));
+    }
+    for (size_t i = 0U; i < src.size(); ++i) {
+        callers.emplace_back([&, i]() {
+            for (int round = 0; round < 8; ++round) {
+                nva_memcpyParallel(dst[i].data(), src[i].data(), kSize, 3U);
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    for (size_t i = 0U; i < src.size(); ++i) {
+        EXPECT_TRUE(eq(dst[i].data(), src[i].data(), kSize)) << "caller = " << i;
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 抓包缓冲区大小的快照                                        */
+TEST(ParallelCopyTest, Stress128M)
+{
+    std::vector<uint8_t> src((128U << 20U) + 7U);
+    std::vector<uint8_t> dst((128U << 20U) + 7U);
+    fill_pattern(src.data(), src.size(), 6U);
+
+    nva_memcpyParallel(dst.data() + 1, src.data() + 3, src.size() - 4U, 0U);
+    EXPECT_TRUE(eq(dst.data() + 1, src.data() + 3, src.size() - 4U));
+}
+
+TEST(ParallelMoveTest, Stress64MOverlap)
+{
+    std::vector<uint8_t> buffer((64U << 20U) + 4096U);
+    fill_pattern(buffer.data(), buffer.size(), 7U);
+    std::vector<uint8_t> golden = buffer;
+
+    std::memmove(golden.data() + 4096U, golden.data(), 64U << 20U);
+    nva_memmoveParallel(buffer.data() + 4096U, buffer.data(), 64U << 20U, 0U);
+    EXPECT_TRUE(eq(buffer.data(), golden.data(), buffer.size()));
+}
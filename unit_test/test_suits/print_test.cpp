@@ -9,8 +9,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdarg>
 
 #include "nva/print.h"
+#include "nva/ext/args.h"
+#ifdef UNIT_TEST_HAS_JSON
+#include "nva/json.h"
+#endif
 
 static struct PrintTargetBuffer {
     std::array<char, 128> buffer;
@@ -36,6 +41,16 @@ extern "C" int nva_putchar(const char c)
         print_target_buffer.index = 0;                               \
     } while (0)
 
+static nva_ErrorCode log_print(const char* format, const char* types, ...)
+{
+    va_list args;
+    va_start(args, types);
+    const nva_ErrorCode code = nva_vprint(format, types, args);
+    va_end(args);
+
+    return code;
+}
+
 TEST(PrintTest, NoneTest)
 {
     NVA_PRINT_EQ("||{{Hello, World!}}__", NVA_START, "||{Hello, World!}__");
@@ -45,3 +60,29 @@ TEST(PrintTest, IntegerTest)
 {
     NVA_PRINT_EQ("int a = {}", nva::add(26471, NVA_START), "int a = 26471");
 }
+
+TEST(PrintTest, VPrintTest)
+{
+    EXPECT_EQ(log_print("[{}] {} = {:.2f}", "sid", "info", 42, 3.14159), NVA_SUCCESS);
+    EXPECT_STREQ(print_target_buffer.buffer.data(), "[info] 42 = 3.14");
+    print_target_buffer.buffer.fill('\0');
+    print_target_buffer.index = 0;
+
+    EXPECT_EQ(log_print("{}", "x", 1), NVA_PARAM_ERROR);
+    print_target_buffer.buffer.fill('\0');
+    print_target_buffer.index = 0;
+}
+
+#ifdef UNIT_TEST_HAS_JSON
+// nva_printJson 在对象之后输出换行，构成 JSON 行
+TEST(PrintTest, JsonLineTest)
+{
+    const char* const keys[] = {"level", "msg"};
+
+    EXPECT_EQ(nva_printJson(keys, NVA_COUNTOF(keys), nva_str("warn", nva_str("disk \"/\" full", NVA_START))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(print_target_buffer.buffer.data(), "{\"level\":\"warn\",\"msg\":\"disk \\\"/\\\" full\"}\n");
+    print_target_buffer.buffer.fill('\0');
+    print_target_buffer.index = 0;
+}
+#endif
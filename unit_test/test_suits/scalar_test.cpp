@@ -0,0 +1,20 @@
+/**
+ * @file scalar_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief unit_test_scalar 的编译检查与 nva_putchar（测试用例来自 bytes/json/csv 与 nva_mem* 的测试文件）
+ */
+
+#include "nva/print.h"
+
+#ifndef NVA_NO_SIMD
+#error "scalar_test.cpp must be built against nva_print_scalar, which defines NVA_NO_SIMD."
+#endif
+
+// 只测试 nva_format 与 nva_ext，nva_putchar 仅用于链接
+extern "C" int nva_putchar(const char c)
+{
+    (void)c;
+
+    return 1;
+}
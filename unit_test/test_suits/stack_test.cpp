@@ -8,6 +8,9 @@
 #include "gtest/gtest.h"
 
 #include "nva/stack.h"
+#include "nva/ext/args.h"
+
+#include <cstring>
 
 class StackTest : public ::testing::Test
 {
@@ -36,6 +39,12 @@ TEST(StackMacroTest, IsSigned)
     EXPECT_FALSE(NVA_IS_SIGNED(NVA_TYPEID_PTR));
     EXPECT_TRUE(NVA_IS_SIGNED(NVA_TYPEID_FLOAT));
     EXPECT_TRUE(NVA_IS_SIGNED(NVA_TYPEID_DOUBLE));
+#ifdef UNIT_TEST_HAS_STRN
+    EXPECT_FALSE(NVA_IS_SIGNED(NVA_TYPEID_STRN));
+#endif
+#ifdef NVA_TYPEID_BYTES
+    EXPECT_FALSE(NVA_IS_SIGNED(NVA_TYPEID_BYTES));
+#endif
     for (int i = 0; i < 256; ++i) {
         nva_TypeId tid = i;
         if (tid == NVA_TYPEID_CHAR) continue;
@@ -63,6 +72,12 @@ TEST(StackMacroTest, IsUnsigned)
     EXPECT_TRUE(NVA_IS_UNSIGNED(NVA_TYPEID_PTR));
     EXPECT_FALSE(NVA_IS_UNSIGNED(NVA_TYPEID_FLOAT));
     EXPECT_FALSE(NVA_IS_UNSIGNED(NVA_TYPEID_DOUBLE));
+#ifdef UNIT_TEST_HAS_STRN
+    EXPECT_FALSE(NVA_IS_UNSIGNED(NVA_TYPEID_STRN));
+#endif
+#ifdef NVA_TYPEID_BYTES
+    EXPECT_FALSE(NVA_IS_UNSIGNED(NVA_TYPEID_BYTES));
+#endif
     for (int i = 0; i < 256; ++i) {
         nva_TypeId tid = i;
         if (tid == NVA_TYPEID_CHAR) continue;
@@ -90,6 +105,12 @@ TEST(StackMacroTest, TypeSize)
     EXPECT_EQ(NVA_TYPE_SIZE(NVA_TYPEID_PTR), sizeof(void*));
     EXPECT_EQ(NVA_TYPE_SIZE(NVA_TYPEID_FLOAT), sizeof(float));
     EXPECT_EQ(NVA_TYPE_SIZE(NVA_TYPEID_DOUBLE), sizeof(double));
+#ifdef UNIT_TEST_HAS_STRN
+    EXPECT_EQ(NVA_TYPE_SIZE(NVA_TYPEID_STRN), sizeof(nva_StrView));
+#endif
+#ifdef NVA_TYPEID_BYTES
+    EXPECT_EQ(NVA_TYPE_SIZE(NVA_TYPEID_BYTES), sizeof(nva_BytesView));
+#endif
     ASSERT_EQ(NVA_TYPE_SIZE(0x56), 0U);  // 测试无效类型ID
 
     for (int i = 0; i < 256; ++i) {
@@ -112,6 +133,14 @@ TEST(StackMacroTest, TypeSize)
             EXPECT_EQ(sz, sizeof(float));
         else if (tid == NVA_TYPEID_DOUBLE)
             EXPECT_EQ(sz, sizeof(double));
+#ifdef UNIT_TEST_HAS_STRN
+        else if (tid == NVA_TYPEID_STRN)
+            EXPECT_EQ(sz, sizeof(nva_StrView));
+#endif
+#ifdef NVA_TYPEID_BYTES
+        else if (tid == NVA_TYPEID_BYTES)
+            EXPECT_EQ(sz, sizeof(nva_BytesView));
+#endif
         else
             EXPECT_EQ(sz, 0U) << "i = " << i;
     }
@@ -241,6 +270,189 @@ TEST_F(StackTest, StackMultiType)
     ASSERT_EQ(stack.data_top, 0);
 }
 
+#ifdef UNIT_TEST_HAS_STRN
+// 带长度的字符串测试
+TEST_F(StackTest, StackStrView)
+{
+    const char buffer[] = {'a', 'b', 'c', 'd'};  // 没有结尾的 '\0'
+    const nva_StrView view{.ptr = buffer, .len = sizeof(buffer)};
+    const int i = 42;
+
+    ASSERT_EQ(nva_stackPush(&stack, &view, NVA_TYPEID_STRN), NVA_SUCCESS);
+    ASSERT_EQ(nva_stackPush(&stack, &i, NVA_TYPEID_SINT), NVA_SUCCESS);
+
+    nva_TypeId tid = 0;
+    nva_StrView view_out{.ptr = nullptr, .len = 0U};
+    int i_out = 0;
+
+    ASSERT_EQ(nva_stackPeek(&stack, 1, &view_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_STRN);
+    EXPECT_EQ(view_out.ptr, buffer);
+    EXPECT_EQ(view_out.len, sizeof(buffer));
+
+    ASSERT_EQ(nva_stackPop(&stack, &i_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_SINT);
+    EXPECT_EQ(i_out, i);
+
+    view_out = {.ptr = nullptr, .len = 0U};
+    ASSERT_EQ(nva_stackPop(&stack, &view_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_STRN);
+    EXPECT_EQ(view_out.ptr, buffer);
+    EXPECT_EQ(view_out.len, sizeof(buffer));
+
+    ASSERT_EQ(stack.type_top, 0);
+    ASSERT_EQ(stack.data_top, 0);
+}
+#endif /* UNIT_TEST_HAS_STRN */
+
+#ifdef NVA_TYPEID_BYTES
+// 字节块测试：只保存指针与长度，不拷贝数据
+TEST_F(StackTest, StackBytesView)
+{
+    const unsigned char packet[] = {0x00, 0xFF, 0x7F, 0x80, 0x00};
+    const nva_BytesView view{.ptr = packet, .len = sizeof(packet)};
+
+    ASSERT_EQ(nva_stackPush(&stack, &view, NVA_TYPEID_BYTES), NVA_SUCCESS);
+    EXPECT_EQ(stack.data_top, sizeof(nva_BytesView));
+
+    nva_TypeId tid = 0;
+    nva_BytesView view_out{.ptr = nullptr, .len = 0U};
+
+    ASSERT_EQ(nva_stackPeek(&stack, 0, &view_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_BYTES);
+    EXPECT_EQ(view_out.ptr, packet);
+    EXPECT_EQ(view_out.len, sizeof(packet));
+
+    view_out = {.ptr = nullptr, .len = 0U};
+    ASSERT_EQ(nva_stackPop(&stack, &view_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_BYTES);
+    EXPECT_EQ(view_out.ptr, packet);
+    EXPECT_EQ(view_out.len, sizeof(packet));
+
+    ASSERT_EQ(stack.type_top, 0);
+    ASSERT_EQ(stack.data_top, 0);
+}
+#endif
+
+// 批量压栈测试
+TEST_F(StackTest, StackPushArgs)
+{
+    const char c = 'A';
+    const int i = -5678;
+    const double d = 2.71828;
+    const char* const str = "Hello, NVA!";
+
+    const nva_TypeId types[] = {NVA_TYPEID_CHAR, NVA_TYPEID_SINT, NVA_TYPEID_DOUBLE, NVA_TYPEID_STR};
+    const void* const values[] = {&c, &i, &d, &str};
+
+    // 等价于按顺序逐个调用 nva_stackPush
+    ASSERT_EQ(nva_stackPushArgs(&stack, types, values, 4U), NVA_SUCCESS);
+
+    nva_Stack expect = NVA_STACK_INIT_VALUE;
+    for (int k = 0; k < 4; ++k) {
+        ASSERT_EQ(nva_stackPush(&expect, values[k], types[k]), NVA_SUCCESS);
+    }
+    ASSERT_EQ(stack.type_top, expect.type_top);
+    ASSERT_EQ(stack.data_top, expect.data_top);
+    EXPECT_EQ(std::memcmp(stack.type, expect.type, stack.type_top), 0);
+    EXPECT_EQ(std::memcmp(stack.data_store, expect.data_store, stack.data_top), 0);
+
+    nva_TypeId tid = 0;
+    const char* str_out = nullptr;
+    double d_out = 0;
+    int i_out = 0;
+    char c_out = 0;
+
+    ASSERT_EQ(nva_stackPop(&stack, &str_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_STR);
+    EXPECT_STREQ(str_out, str);
+    ASSERT_EQ(nva_stackPop(&stack, &d_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_DOUBLE);
+    EXPECT_DOUBLE_EQ(d_out, d);
+    ASSERT_EQ(nva_stackPop(&stack, &i_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_SINT);
+    EXPECT_EQ(i_out, i);
+    ASSERT_EQ(nva_stackPop(&stack, &c_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(tid, NVA_TYPEID_CHAR);
+    EXPECT_EQ(c_out, c);
+
+    // n 为 0 时什么也不做
+    ASSERT_EQ(nva_stackPushArgs(&stack, types, values, 0U), NVA_SUCCESS);
+    ASSERT_EQ(stack.type_top, 0);
+    ASSERT_EQ(stack.data_top, 0);
+
+    EXPECT_EQ(nva_stackPushArgs(nullptr, types, values, 4U), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_stackPushArgs(&stack, nullptr, values, 4U), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_stackPushArgs(&stack, types, nullptr, 4U), NVA_PARAM_ERROR);
+
+    // 无效的类型ID或空指针出现在中间时整批都不压入
+    const nva_TypeId bad_types[] = {NVA_TYPEID_SINT, 0x56};
+    EXPECT_EQ(nva_stackPushArgs(&stack, bad_types, values, 2U), NVA_PARAM_ERROR);
+    const void* const bad_values[] = {&i, nullptr};
+    EXPECT_EQ(nva_stackPushArgs(&stack, types, bad_values, 2U), NVA_PARAM_ERROR);
+    EXPECT_EQ(stack.type_top, 0);
+    EXPECT_EQ(stack.data_top, 0);
+}
+
+// 批量压栈空间不足时栈保持不变
+TEST_F(StackTest, StackPushArgsOverflow)
+{
+    const double d = 1.0;
+    nva_TypeId types[NVA_STACK_DEFAULT_SIZE];
+    const void* values[NVA_STACK_DEFAULT_SIZE];
+
+    for (int k = 0; k < NVA_STACK_DEFAULT_SIZE; ++k) {
+        types[k] = NVA_TYPEID_DOUBLE;
+        values[k] = &d;
+    }
+
+    ASSERT_EQ(nva_stackPush(&stack, &d, NVA_TYPEID_DOUBLE), NVA_SUCCESS);
+
+    EXPECT_EQ(nva_stackPushArgs(&stack, types, values, NVA_STACK_DEFAULT_SIZE), NVA_FAIL);
+    EXPECT_EQ(stack.type_top, 1);
+    EXPECT_EQ(stack.data_top, sizeof(double));
+}
+
+#ifdef UNIT_TEST_HAS_HIGH_WATER
+// 高水位测试：峰值只增不减，直到重新初始化
+TEST_F(StackTest, StackPeak)
+{
+    const int i = 42;
+    const double d = 2.5;
+    int i_out = 0;
+    double d_out = 0;
+    nva_TypeId tid = 0;
+
+    ASSERT_EQ(nva_stackPush(&stack, &i, NVA_TYPEID_SINT), NVA_SUCCESS);
+    ASSERT_EQ(nva_stackPush(&stack, &d, NVA_TYPEID_DOUBLE), NVA_SUCCESS);
+    EXPECT_EQ(stack.type_peak, 2);
+    EXPECT_EQ(stack.data_peak, sizeof(int) + sizeof(double));
+
+    ASSERT_EQ(nva_stackPop(&stack, &d_out, &tid), NVA_SUCCESS);
+    ASSERT_EQ(nva_stackPop(&stack, &i_out, &tid), NVA_SUCCESS);
+    EXPECT_EQ(stack.type_top, 0);
+    EXPECT_EQ(stack.type_peak, 2);
+    EXPECT_EQ(stack.data_peak, sizeof(int) + sizeof(double));
+
+    ASSERT_EQ(nva_stackPush(&stack, &i, NVA_TYPEID_SINT), NVA_SUCCESS);
+    EXPECT_EQ(stack.type_peak, 2);
+    EXPECT_EQ(stack.data_peak, sizeof(int) + sizeof(double));
+
+    // 失败的压栈不改变峰值
+    const double big[NVA_STACK_DEFAULT_SIZE] = {};
+    for (const auto& value : big) {
+        if (nva_stackPush(&stack, &value, NVA_TYPEID_DOUBLE) != NVA_SUCCESS) break;
+    }
+    EXPECT_EQ(stack.type_peak, stack.type_top);
+    EXPECT_EQ(stack.data_peak, stack.data_top);
+    EXPECT_LE(stack.data_peak, NVA_STACK_DEFAULT_SIZE);
+
+    ASSERT_EQ(nva_stackInit(&stack), NVA_SUCCESS);
+    EXPECT_EQ(stack.type_peak, 0);
+    EXPECT_EQ(stack.data_peak, 0);
+}
+#endif /* UNIT_TEST_HAS_HIGH_WATER */
+
 // NVA_STACK_INIT_VALUE 测试
 TEST(StackMacroTest, StackInitValue)
 {
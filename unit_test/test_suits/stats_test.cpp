@@ -0,0 +1,156 @@
+/**
+ * @file stats_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 统计计数与钩子测试（由 unit_test_stats 编译，nva_print 开启 NVA_ENABLE_STATS）
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/stats.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef NVA_ENABLE_STATS
+#error "stats_test.cpp must be built against nva_print with NVA_ENABLE_STATS."
+#endif
+
+static struct HookRecord {
+    unsigned long clock;
+    unsigned long begin_calls;
+    unsigned long end_calls;
+    const char* last_format;
+    int last_code;
+    std::vector<nva_TypeId> fields;
+} hook_record{};
+
+static std::string print_output;
+
+extern "C" int nva_putchar(const char c)
+{
+    print_output += c;
+
+    return 1;
+}
+
+/* 每读取一次前进 1，使每个计时阶段都能得到非零的结果 */
+extern "C" unsigned long nva_testStatsClock(void)
+{
+    return ++hook_record.clock;
+}
+
+extern "C" void nva_testHookFormatBegin(const char* const format)
+{
+    ++hook_record.begin_calls;
+    hook_record.last_format = format;
+}
+
+extern "C" void nva_testHookFormatEnd(const char* const format, const int code)
+{
+    ++hook_record.end_calls;
+    hook_record.last_format = format;
+    hook_record.last_code = code;
+}
+
+extern "C" void nva_testHookField(const unsigned char type)
+{
+    hook_record.fields.push_back(type);
+}
+
+class StatsTest : public ::testing::Test
+{
+protected:
+    char dst[128]{};
+
+    void SetUp() override
+    {
+        nva_statsReset();
+        hook_record = HookRecord{};
+        print_output.clear();
+    }
+};
+
+TEST_F(StatsTest, Reset)
+{
+    ASSERT_EQ(nva_format(dst, "{}", nva_int(1, NVA_START)), NVA_SUCCESS);
+    nva_statsReset();
+
+    const nva_Stats* const stats = nva_statsGet();
+    ASSERT_NE(stats, nullptr);
+    EXPECT_EQ(stats->format_calls, 0U);
+    EXPECT_EQ(stats->bytes_emitted, 0U);
+    EXPECT_EQ(stats->stack_pushes, 0U);
+    EXPECT_EQ(stats->stack_pops, 0U);
+    EXPECT_EQ(stats->sink_calls, 0U);
+    EXPECT_EQ(stats->parse_time, 0U);
+    EXPECT_EQ(stats->convert_time, 0U);
+    EXPECT_EQ(stats->emit_time, 0U);
+    EXPECT_EQ(nva_statsFieldCount(NVA_TYPEID_SINT), 0U);
+}
+
+TEST_F(StatsTest, Counters)
+{
+    ASSERT_EQ(nva_format(dst, "{} {} {}", nva_int(42, nva_str("abc", nva_int(-1, NVA_START)))), NVA_SUCCESS);
+    ASSERT_STREQ(dst, "42 abc -1");
+
+    const nva_Stats* const stats = nva_statsGet();
+    EXPECT_EQ(stats->format_calls, 1U);
+    EXPECT_EQ(stats->bytes_emitted, std::strlen(dst));
+    EXPECT_EQ(stats->stack_pushes, 3U);
+    EXPECT_EQ(stats->stack_pops, 3U);
+    EXPECT_EQ(stats->sink_calls, 0U);  // nva_format 不经过 nva_putchar
+
+    EXPECT_EQ(nva_statsFieldCount(NVA_TYPEID_SINT), 2U);
+    EXPECT_EQ(nva_statsFieldCount(NVA_TYPEID_STR), 1U);
+    EXPECT_EQ(nva_statsFieldCount(NVA_TYPEID_DOUBLE), 0U);
+
+    ASSERT_EQ(nva_format(dst, "{:.2f}", nva_double(3.14159, NVA_START)), NVA_SUCCESS);
+    EXPECT_EQ(stats->format_calls, 2U);
+    EXPECT_EQ(stats->bytes_emitted, std::strlen("42 abc -1") + std::strlen("3.14"));
+    EXPECT_EQ(nva_statsFieldCount(NVA_TYPEID_DOUBLE), 1U);
+}
+
+TEST_F(StatsTest, Timing)
+{
+    ASSERT_EQ(nva_format(dst, "value = {:>8}", nva_int(12345, NVA_START)), NVA_SUCCESS);
+
+    const nva_Stats* const stats = nva_statsGet();
+    EXPECT_GT(stats->parse_time, 0U);
+    EXPECT_GT(stats->convert_time, 0U);
+    EXPECT_GT(stats->emit_time, 0U);
+    EXPECT_LE(stats->parse_time + stats->convert_time + stats->emit_time, hook_record.clock);
+}
+
+TEST_F(StatsTest, Hooks)
+{
+    const char* const format = "{}, {}";
+
+    ASSERT_EQ(nva_format(dst, format, nva_char('x', nva_uint(7U, NVA_START))), NVA_SUCCESS);
+
+    EXPECT_EQ(hook_record.begin_calls, 1U);
+    EXPECT_EQ(hook_record.end_calls, 1U);
+    EXPECT_EQ(hook_record.last_format, format);
+    EXPECT_EQ(hook_record.last_code, NVA_SUCCESS);
+    EXPECT_EQ(hook_record.fields, (std::vector<nva_TypeId>{NVA_TYPEID_CHAR, NVA_TYPEID_UINT}));
+
+    // 失败的调用同样触发结束钩子，并带上错误码
+    EXPECT_EQ(nva_format(dst, "{}", NVA_ERROR), NVA_FAIL);
+    EXPECT_EQ(hook_record.begin_calls, 2U);
+    EXPECT_EQ(hook_record.end_calls, 2U);
+    EXPECT_EQ(hook_record.last_code, NVA_FAIL);
+}
+
+// nva_print 逐字节调用 nva_putchar
+TEST_F(StatsTest, Print)
+{
+    ASSERT_EQ(nva_print("x = {}\n", nva_int(-15, NVA_START)), NVA_SUCCESS);
+    ASSERT_EQ(print_output, "x = -15\n");
+
+    const nva_Stats* const stats = nva_statsGet();
+    EXPECT_EQ(stats->format_calls, 1U);
+    EXPECT_EQ(stats->sink_calls, 8U);
+    EXPECT_EQ(stats->bytes_emitted, 8U);
+}
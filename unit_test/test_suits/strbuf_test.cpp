@@ -0,0 +1,212 @@
+/**
+ * @file strbuf_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 记录长度的字符串构建器 nva_StrBuf 测试
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/ext/strbuf.h"
+
+#include <cstring>
+#include <string>
+
+/* buf 始终以 '\0' 结尾，且 len 与实际长度一致 */
+#define NVA_EXPECT_STRBUF(sb, expect)                        \
+    do {                                                     \
+        EXPECT_STREQ((sb).buf, (expect));                    \
+        EXPECT_EQ((sb).len, std::strlen(expect));            \
+        EXPECT_EQ((sb).len, std::strlen((sb).buf));          \
+    } while (0)
+
+class StrBufTest : public ::testing::Test
+{
+protected:
+    char storage[32]{};
+    nva_StrBuf sb{};
+
+    void SetUp() override
+    {
+        std::memset(storage, 'x', sizeof(storage));
+        ASSERT_EQ(nva_strBufInit(&sb, storage, sizeof(storage)), NVA_SUCCESS);
+    }
+};
+
+TEST_F(StrBufTest, Init)
+{
+    EXPECT_EQ(sb.buf, storage);
+    EXPECT_EQ(sb.cap, sizeof(storage));
+    NVA_EXPECT_STRBUF(sb, "");
+
+    nva_StrBuf other{};
+    EXPECT_EQ(nva_strBufInit(nullptr, storage, sizeof(storage)), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_strBufInit(&other, nullptr, sizeof(storage)), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_strBufInit(&other, storage, 0U), NVA_PARAM_ERROR);  // 至少要能放下 '\0'
+}
+
+TEST_F(StrBufTest, AppendStrAndChar)
+{
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "Hello"), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, ','), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, ' '), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "World"), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendStr(&sb, ""), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, '!'), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "Hello, World!");
+
+    nva_strBufClear(&sb);
+    NVA_EXPECT_STRBUF(sb, "");
+    EXPECT_EQ(sb.cap, sizeof(storage));
+
+    EXPECT_EQ(nva_strBufAppendStr(&sb, nullptr), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_strBufAppendStr(nullptr, "a"), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_strBufAppendChar(nullptr, 'a'), NVA_PARAM_ERROR);
+}
+
+TEST_F(StrBufTest, AppendFormat)
+{
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "reg"), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendFormat(&sb, "[{}] = 0x{:04X}", nva_int(3, nva_uint(0x1FU, NVA_START))), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "reg[3] = 0x001F");
+
+    ASSERT_EQ(nva_strBufAppendFormat(&sb, "; {:.2f}", nva_double(2.5, NVA_START)), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "reg[3] = 0x001F; 2.50");
+
+    // 与直接写入 nva_format 的结果相同
+    char direct[32] = {0};
+    ASSERT_EQ(nva_format(direct, "reg[{}] = 0x{:04X}; {:.2f}", nva_int(3, nva_uint(0x1FU, nva_double(2.5, NVA_START)))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(sb.buf, direct);
+
+    // 参数链中的错误原样返回，内容不变
+    EXPECT_EQ(nva_strBufAppendFormat(&sb, "{}", NVA_ERROR), NVA_FAIL);
+    NVA_EXPECT_STRBUF(sb, "reg[3] = 0x001F; 2.50");
+}
+
+TEST_F(StrBufTest, AppendNumbers)
+{
+    ASSERT_EQ(nva_strBufAppendInt(&sb, -12345, nullptr), NVA_SUCCESS);  // nullptr 表示十进制
+    ASSERT_EQ(nva_strBufAppendChar(&sb, ' '), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendUint(&sb, 4294967295U, nullptr), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, ' '), NVA_SUCCESS);
+
+    const nva_NumToStringAttr hex{.base = 16, .upper_case = 1};
+    ASSERT_EQ(nva_strBufAppendUint(&sb, 0xBEEFU, &hex), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, ' '), NVA_SUCCESS);
+
+    const nva_FloatPointToStrAttr fp{.base = 10,
+                                     .precision = 3,
+                                     .flag = {.keep_decimal_point = 0, .upper_case = 0, .type = NVA_FP_TO_STR_TYPE_F}};
+    ASSERT_EQ(nva_strBufAppendFloat(&sb, -2.5, &fp), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "-12345 4294967295 BEEF -2.500");
+}
+
+/*----------------------------------------------------------*/
+/* 边界：恰好填满可以成功，多一个字节则失败且内容不变              */
+TEST_F(StrBufTest, ExactFit)
+{
+    const std::string fill(sizeof(storage) - 2U, 'a');
+
+    ASSERT_EQ(nva_strBufAppendStr(&sb, fill.c_str()), NVA_SUCCESS);
+    ASSERT_EQ(nva_strBufAppendChar(&sb, 'b'), NVA_SUCCESS);
+    EXPECT_EQ(sb.len, sizeof(storage) - 1U);
+    EXPECT_EQ(storage[sizeof(storage) - 1U], '\0');
+
+    EXPECT_EQ(nva_strBufAppendChar(&sb, 'c'), NVA_FAIL);
+    EXPECT_EQ(nva_strBufAppendStr(&sb, ""), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, (fill + "b").c_str());
+}
+
+TEST_F(StrBufTest, OverflowKeepsContent)
+{
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "prefix:"), NVA_SUCCESS);
+
+    const std::string too_long(sizeof(storage), 'z');
+    EXPECT_EQ(nva_strBufAppendStr(&sb, too_long.c_str()), NVA_FAIL);
+    NVA_EXPECT_STRBUF(sb, "prefix:");
+
+    EXPECT_EQ(nva_strBufAppendInt(&sb, 1234567890, nullptr), NVA_SUCCESS);
+    EXPECT_EQ(nva_strBufAppendInt(&sb, -1234567890, nullptr), NVA_SUCCESS);
+    EXPECT_EQ(nva_strBufAppendInt(&sb, -1234567890, nullptr), NVA_FAIL);
+    NVA_EXPECT_STRBUF(sb, "prefix:1234567890-1234567890");
+
+    // 格式化溢出时，已经写出的部分被撤销
+    EXPECT_EQ(nva_strBufAppendFormat(&sb, "{}{}", nva_str("ab", nva_str("cd", NVA_START))), NVA_FAIL);
+    NVA_EXPECT_STRBUF(sb, "prefix:1234567890-1234567890");
+
+    // 失败之后参数栈被清空，后续调用不受影响
+    EXPECT_EQ(nva_strBufAppendFormat(&sb, "{}", nva_int(7, NVA_START)), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "prefix:1234567890-12345678907");
+}
+
+/* 溢出检查不能越过 cap 写入 */
+TEST(StrBufBoundTest, NoWriteBeyondCap)
+{
+    char storage[16];
+    std::memset(storage, '#', sizeof(storage));
+
+    nva_StrBuf sb{};
+    ASSERT_EQ(nva_strBufInit(&sb, storage, 8U), NVA_SUCCESS);
+    EXPECT_EQ(nva_strBufAppendStr(&sb, "0123456789"), NVA_FAIL);
+    EXPECT_EQ(nva_strBufAppendFormat(&sb, "{:>12}", nva_int(1, NVA_START)), NVA_FAIL);
+    EXPECT_EQ(nva_strBufAppendUint(&sb, 4294967295U, nullptr), NVA_FAIL);
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "0123456"), NVA_SUCCESS);
+
+    for (std::size_t i = 8U; i < sizeof(storage); ++i) {
+        EXPECT_EQ(storage[i], '#') << "i = " << i;
+    }
+}
+
+/* 剩余空间足够时浮点数与格式化结果直接写在末尾，不足时经由暂存区，两种路径结果相同 */
+TEST(StrBufTailTest, InPlaceAndScratch)
+{
+    static char storage[NVA_STRBUF_FORMAT_SIZE + 640U];
+    const nva_FloatPointToStrAttr fp{.base = 10,
+                                     .precision = 2,
+                                     .flag = {.keep_decimal_point = 0, .upper_case = 0, .type = NVA_FP_TO_STR_TYPE_F}};
+    nva_StrBuf sb{};
+    std::string expect;
+
+    ASSERT_EQ(nva_strBufInit(&sb, storage, sizeof(storage)), NVA_SUCCESS);
+    while (sb.cap - sb.len > 16U) {
+        const std::string offset = std::to_string(sb.len);
+
+        ASSERT_EQ(nva_strBufAppendFormat(&sb, "{:>5}|", nva_uint(static_cast<unsigned int>(sb.len), NVA_START)),
+                  NVA_SUCCESS);
+        ASSERT_EQ(nva_strBufAppendFloat(&sb, 1.5, &fp), NVA_SUCCESS);
+        expect += std::string(5U - offset.size(), ' ') + offset + "|1.50";
+    }
+    NVA_EXPECT_STRBUF(sb, expect.c_str());
+
+    // 格式化出错时，直接写在末尾的部分被撤销
+    nva_strBufClear(&sb);
+    ASSERT_EQ(nva_strBufAppendStr(&sb, "keep"), NVA_SUCCESS);
+    EXPECT_NE(nva_strBufAppendFormat(&sb, "{} {}", nva_int(1, NVA_START)), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "keep");
+
+    EXPECT_EQ(nva_strBufAppendFormat(nullptr, "{}", nva_int(1, NVA_START)), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_strBufAppendFormat(&sb, "{}", nva_int(2, NVA_START)), NVA_SUCCESS);
+    NVA_EXPECT_STRBUF(sb, "keep2");
+}
+
+/*----------------------------------------------------------*/
+/* 由大量片段构建长消息，结果与 std::string 相同                  */
+TEST(StrBufBuildTest, ManyPieces)
+{
+    static char storage[1U << 20U];
+    nva_StrBuf sb{};
+    ASSERT_EQ(nva_strBufInit(&sb, storage, sizeof(storage)), NVA_SUCCESS);
+
+    std::string expect;
+    for (int i = 0; i < 20000; ++i) {
+        ASSERT_EQ(nva_strBufAppendStr(&sb, "item"), NVA_SUCCESS);
+        ASSERT_EQ(nva_strBufAppendInt(&sb, i, nullptr), NVA_SUCCESS);
+        ASSERT_EQ(nva_strBufAppendChar(&sb, ','), NVA_SUCCESS);
+        expect += "item" + std::to_string(i) + ",";
+    }
+
+    EXPECT_EQ(sb.len, expect.size());
+    EXPECT_EQ(std::string(sb.buf, sb.len), expect);
+}
@@ -0,0 +1,219 @@
+/**
+ * @file timestamp_test.cpp
+ * @author DuYicheng
+ * @date 2026-10-19
+ * @brief 日志行时间戳前缀 nva_timestampRender 测试：与 gmtime/strftime 对照，以及秒级缓存的复用与失效
+ */
+
+#include "gtest/gtest.h"
+
+#include "nva/print.h"
+#include "nva/ext/timestamp.h"
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <thread>
+
+/*----------------------------------------------------------*/
+/* 参考实现：gmtime + strftime + 微秒                          */
+static std::string ref_timestamp(const unsigned long long sec, const unsigned long usec)
+{
+    const auto t = static_cast<std::time_t>(sec);
+    std::tm tm{};
+    char date[32] = {0};
+    char text[40] = {0};
+
+    gmtime_r(&t, &tm);
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &tm);
+    std::snprintf(text, sizeof(text), "%s.%06lu", date, usec);
+
+    return text;
+}
+
+class TimestampTest : public ::testing::Test
+{
+protected:
+    nva_TimestampCache cache = NVA_TIMESTAMP_CACHE_INIT_VALUE;
+    char dst[NVA_TIMESTAMP_LEN + 1] = {0};
+
+    void SetUp() override
+    {
+        ASSERT_EQ(nva_timestampCacheInit(&cache), NVA_SUCCESS);
+    }
+
+    ::testing::AssertionResult rendered(const unsigned long long sec, const unsigned long usec)
+    {
+        if (nva_timestampRender(&cache, sec, usec, dst) != NVA_SUCCESS) {
+            return ::testing::AssertionFailure() << "render failed, sec = " << sec << ", usec = " << usec;
+        }
+
+        const std::string expect = ref_timestamp(sec, usec);
+        if (expect != dst) {
+            return ::testing::AssertionFailure() << "sec = " << sec << ", usec = " << usec << ": \"" << dst
+                                                 << "\" != \"" << expect << "\"";
+        }
+
+        return ::testing::AssertionSuccess();
+    }
+};
+
+/*----------------------------------------------------------*/
+/* 固定宽度 YYYY-MM-DD HH:MM:SS.uuuuuu，UTC                     */
+TEST_F(TimestampTest, Basic)
+{
+    ASSERT_EQ(nva_timestampRender(&cache, 0U, 0U, dst), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "1970-01-01 00:00:00.000000");
+    EXPECT_EQ(std::string(dst).size(), static_cast<std::size_t>(NVA_TIMESTAMP_LEN));
+
+    ASSERT_EQ(nva_timestampRender(&cache, 1760832000U, 7U, dst), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "2025-10-19 00:00:00.000007");
+
+    ASSERT_EQ(nva_timestampRender(&cache, 1760875199U, 999999U, dst), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "2025-10-19 11:59:59.999999");
+}
+
+/* 闰年、世纪年与月末 */
+TEST_F(TimestampTest, CalendarEdges)
+{
+    const unsigned long long days[] = {
+        951782400ULL,   // 2000-02-29，400 的倍数是闰年
+        951868800ULL,   // 2000-03-01
+        1709164800ULL,  // 2024-02-29
+        1709251200ULL,  // 2024-03-01
+        1677542400ULL,  // 2023-02-28
+        1677628800ULL,  // 2023-03-01
+        4107456000ULL,  // 2100-02-28，100 的倍数不是闰年，次日为 03-01
+        4107542400ULL,  // 2100-03-01
+        1703980800ULL,  // 2023-12-31
+        1704067200ULL,  // 2024-01-01
+    };
+
+    for (const unsigned long long day : days) {
+        EXPECT_TRUE(rendered(day, 0U));
+        EXPECT_TRUE(rendered(day + 86399U, 123456U));  // 当天最后一秒
+    }
+
+    EXPECT_TRUE(rendered(253402300799ULL, 999999U));  // 9999-12-31 23:59:59
+}
+
+/* 逐秒前进，覆盖日期与时分秒的所有进位 */
+TEST_F(TimestampTest, EverySecondOfTwoDays)
+{
+    const unsigned long long begin = 1735603200ULL;  // 2024-12-31 00:00:00
+
+    for (unsigned long long sec = begin; sec < begin + 2U * 86400U; ++sec) {
+        ASSERT_TRUE(rendered(sec, (sec * 7919U) % 1000000U));
+    }
+}
+
+/* 跨越多年的随机秒数，相邻两次调用通常不在同一秒 */
+TEST_F(TimestampTest, RandomSeconds)
+{
+    unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+
+    for (int i = 0; i < 100000; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const unsigned long long sec = (seed >> 16U) % 253402300800ULL;
+        ASSERT_TRUE(rendered(sec, static_cast<unsigned long>((seed >> 8U) % 1000000U)));
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 同一秒内只改写微秒部分                                        */
+TEST_F(TimestampTest, SameSecond)
+{
+    for (unsigned long usec = 0U; usec < 1000000U; usec += 37U) {
+        ASSERT_TRUE(rendered(1760832000U, usec));
+    }
+    ASSERT_TRUE(rendered(1760832000U, 999999U));
+}
+
+/* 同一秒内复用缓存中已经生成的日期与时分秒 */
+TEST_F(TimestampTest, ReusesCachedSecond)
+{
+    ASSERT_TRUE(rendered(1760832000U, 1U));
+
+    // 改写缓存中的秒级部分：同一秒不会重新生成，因此改动会出现在输出中
+    cache.text[0] = 'X';
+    ASSERT_EQ(nva_timestampRender(&cache, 1760832000U, 2U, dst), NVA_SUCCESS);
+    EXPECT_STREQ(dst, "X025-10-19 00:00:00.000002");
+
+    // 秒数改变后重新生成
+    EXPECT_TRUE(rendered(1760832001U, 3U));
+
+    // 时间回退同样要重新生成
+    EXPECT_TRUE(rendered(1760832000U, 4U));
+
+    // 重新初始化之后缓存失效
+    cache.text[0] = 'X';
+    ASSERT_EQ(nva_timestampCacheInit(&cache), NVA_SUCCESS);
+    EXPECT_TRUE(rendered(1760832000U, 5U));
+}
+
+/* 缓存按调用者（线程）各自持有，互不影响 */
+TEST_F(TimestampTest, PerThreadCache)
+{
+    constexpr int kThreads = 4;
+    bool ok[kThreads] = {};
+    std::thread threads[kThreads];
+
+    for (int t = 0; t < kThreads; ++t) {
+        threads[t] = std::thread([t, &ok] {
+            nva_TimestampCache local = NVA_TIMESTAMP_CACHE_INIT_VALUE;
+            char out[NVA_TIMESTAMP_LEN + 1] = {0};
+            bool good = true;
+
+            const unsigned long long begin = 1700000000ULL + t * 100000ULL;
+            for (unsigned long long sec = begin; sec < begin + 20000U; ++sec) {
+                for (unsigned long usec = 0U; usec < 3U; ++usec) {
+                    good = good && nva_timestampRender(&local, sec, usec, out) == NVA_SUCCESS &&
+                           ref_timestamp(sec, usec) == out;
+                }
+            }
+            ok[t] = good;
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < kThreads; ++t) {
+        EXPECT_TRUE(ok[t]) << "thread " << t;
+    }
+}
+
+/*----------------------------------------------------------*/
+/* 作为日志行前缀，与七个整数参数的 nva_format 结果相同              */
+TEST_F(TimestampTest, LogLinePrefix)
+{
+    char line[128] = {0};
+    char expect[128] = {0};
+
+    ASSERT_EQ(nva_timestampRender(&cache, 1760875199U, 42U, line), NVA_SUCCESS);
+    ASSERT_EQ(nva_format(line + NVA_TIMESTAMP_LEN, " [{}] {}", nva_str("info", nva_str("started", NVA_START))),
+              NVA_SUCCESS);
+
+    const nva_ErrorCode tail = nva_ulong(42UL, nva_str("info", nva_str("started", NVA_START)));
+    ASSERT_EQ(nva_format(expect, "{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}.{:06d} [{}] {}",
+                         nva_int(2025, nva_int(10, nva_int(19, nva_int(11, nva_int(59, nva_int(59, tail))))))),
+              NVA_SUCCESS);
+    EXPECT_STREQ(line, expect);
+    EXPECT_STREQ(line, "2025-10-19 11:59:59.000042 [info] started");
+}
+
+TEST_F(TimestampTest, Errors)
+{
+    EXPECT_EQ(nva_timestampRender(nullptr, 0U, 0U, dst), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_timestampRender(&cache, 0U, 0U, nullptr), NVA_PARAM_ERROR);
+    EXPECT_EQ(nva_timestampCacheInit(nullptr), NVA_PARAM_ERROR);
+
+    // 微秒超出范围
+    EXPECT_EQ(nva_timestampRender(&cache, 0U, 1000000U, dst), NVA_PARAM_ERROR);
+
+    // 超出四位年份
+    EXPECT_EQ(nva_timestampRender(&cache, 253402300800ULL, 0U, dst), NVA_FAIL);
+
+    // 失败不影响之后的调用
+    EXPECT_TRUE(rendered(253402300799ULL, 0U));
+}